@@ -0,0 +1,177 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qhelpcollectioncache_p.h"
+#include "qhelpfilterdata.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QVersionNumber>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The index and contents of a filter are cached in files next to the
+    full text search index of the collection. Every cache file starts
+    with a header holding a key over the filter definition and the size
+    and modification time of every registered documentation file, so a
+    cache is only used while nothing it was built from has changed.
+    The files are memory mapped for reading.
+*/
+
+static const quint32 cacheMagic = 0x51484343; // "QHCC"
+static const quint32 cacheVersion = 1;
+
+static QDataStream &operator<<(QDataStream &s, const QHelpCollectionHandler::ContentsData &data)
+{
+    return s << data.namespaceName << data.folderName << data.contentsList;
+}
+
+static QDataStream &operator>>(QDataStream &s, QHelpCollectionHandler::ContentsData &data)
+{
+    return s >> data.namespaceName >> data.folderName >> data.contentsList;
+}
+
+template <typename T>
+static bool readCacheFile(const QString &fileName, const QByteArray &stateKey, T *data)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    const qint64 size = file.size();
+    const uchar *mapped = file.map(0, size);
+    const QByteArray bytes = mapped
+            ? QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), size)
+            : file.readAll();
+
+    QDataStream s(bytes);
+    s.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray key;
+    s >> magic >> version >> key;
+    if (magic != cacheMagic || version != cacheVersion || key != stateKey)
+        return false;
+
+    T result;
+    s >> result;
+    if (s.status() != QDataStream::Ok)
+        return false;
+
+    *data = result;
+    return true;
+}
+
+template <typename T>
+static bool writeCacheFile(const QString &fileName, const QByteArray &stateKey, const T &data)
+{
+    if (!QDir().mkpath(QFileInfo(fileName).absolutePath()))
+        return false;
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream s(&file);
+    s.setVersion(QDataStream::Qt_6_0);
+    s << cacheMagic << cacheVersion << stateKey << data;
+    if (s.status() != QDataStream::Ok) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+QHelpCollectionCache::QHelpCollectionCache(const QHelpCollectionHandler &collectionHandler,
+                                           const QString &filterName)
+{
+    const QHelpFilterData filterData = collectionHandler.filterData(filterName);
+    QByteArray filterKey = "filter\n" + filterName.toUtf8() + '\n';
+    for (const QString &component : filterData.components())
+        filterKey += component.toUtf8() + '\n';
+    for (const QVersionNumber &version : filterData.versions())
+        filterKey += version.toString().toUtf8() + '\n';
+    init(collectionHandler, filterKey);
+}
+
+QHelpCollectionCache::QHelpCollectionCache(const QHelpCollectionHandler &collectionHandler,
+                                           const QStringList &filterAttributes)
+{
+    QByteArray filterKey = "attributes\n";
+    for (const QString &attribute : filterAttributes)
+        filterKey += attribute.toUtf8() + '\n';
+    init(collectionHandler, filterKey);
+}
+
+void QHelpCollectionCache::init(const QHelpCollectionHandler &collectionHandler,
+                                const QByteArray &filterKey)
+{
+    const QFileInfo fi(collectionHandler.collectionFile());
+    m_cacheDir = fi.absolutePath() + QLatin1String("/.")
+            + fi.fileName().left(fi.fileName().lastIndexOf(QLatin1String(".qhc")))
+            + QLatin1String("/cache");
+    m_filterId = QCryptographicHash::hash(filterKey, QCryptographicHash::Sha1).toHex();
+
+    QHelpCollectionHandler::FileInfoList docs = collectionHandler.registeredDocumentations();
+    std::sort(docs.begin(), docs.end(), [](const QHelpCollectionHandler::FileInfo &a,
+                                           const QHelpCollectionHandler::FileInfo &b) {
+        return a.namespaceName < b.namespaceName;
+    });
+
+    // Each field is followed by a NUL byte, which cannot be part of any of
+    // them, so that different fields cannot give the same data.
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    const auto addField = [&hash](QByteArrayView field) {
+        static constexpr char separator = '\0';
+        hash.addData(field);
+        hash.addData(QByteArrayView(&separator, 1));
+    };
+    addField(filterKey);
+    for (const QHelpCollectionHandler::FileInfo &doc : qAsConst(docs)) {
+        const QFileInfo docInfo(collectionHandler.absoluteDocPath(doc.fileName));
+        addField(doc.namespaceName.toUtf8());
+        addField(doc.folderName.toUtf8());
+        addField(docInfo.absoluteFilePath().toUtf8());
+        addField(QByteArray::number(docInfo.size()));
+        addField(QByteArray::number(docInfo.lastModified().toMSecsSinceEpoch()));
+    }
+    m_stateKey = hash.result();
+}
+
+QString QHelpCollectionCache::cacheFileName(QLatin1String kind) const
+{
+    return m_cacheDir + QLatin1Char('/') + kind + QLatin1Char('-')
+            + QLatin1String(m_filterId) + QLatin1String(".cache");
+}
+
+bool QHelpCollectionCache::readIndices(QStringList *indices) const
+{
+    return readCacheFile(cacheFileName(QLatin1String("indices")), m_stateKey, indices);
+}
+
+bool QHelpCollectionCache::writeIndices(const QStringList &indices) const
+{
+    return writeCacheFile(cacheFileName(QLatin1String("indices")), m_stateKey, indices);
+}
+
+bool QHelpCollectionCache::readContents(QList<QHelpCollectionHandler::ContentsData> *contents) const
+{
+    return readCacheFile(cacheFileName(QLatin1String("contents")), m_stateKey, contents);
+}
+
+bool QHelpCollectionCache::writeContents(
+        const QList<QHelpCollectionHandler::ContentsData> &contents) const
+{
+    return writeCacheFile(cacheFileName(QLatin1String("contents")), m_stateKey, contents);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,50 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QHELPCOLLECTIONCACHE_H
+#define QHELPCOLLECTIONCACHE_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists for the convenience
+// of the help generator tools. This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qhelpcollectionhandler_p.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+QT_BEGIN_NAMESPACE
+
+class QHelpCollectionCache
+{
+public:
+    QHelpCollectionCache(const QHelpCollectionHandler &collectionHandler,
+                         const QString &filterName);
+    QHelpCollectionCache(const QHelpCollectionHandler &collectionHandler,
+                         const QStringList &filterAttributes);
+
+    bool readIndices(QStringList *indices) const;
+    bool writeIndices(const QStringList &indices) const;
+    bool readContents(QList<QHelpCollectionHandler::ContentsData> *contents) const;
+    bool writeContents(const QList<QHelpCollectionHandler::ContentsData> &contents) const;
+
+private:
+    void init(const QHelpCollectionHandler &collectionHandler, const QByteArray &filterKey);
+    QString cacheFileName(QLatin1String kind) const;
+
+    QString m_cacheDir;
+    QByteArray m_filterId;
+    QByteArray m_stateKey;
+};
+
+QT_END_NAMESPACE
+
+#endif // QHELPCOLLECTIONCACHE_H
@@ -23,6 +23,9 @@
 
 QT_BEGIN_NAMESPACE
 
+// Upper bound, in bytes, for the uncompressed file data kept by fileData().
+static const qsizetype fileDataCacheSize = 16 * 1024 * 1024;
+
 class Transaction
 {
 public:
@@ -57,6 +60,7 @@ private:
 QHelpCollectionHandler::QHelpCollectionHandler(const QString &collectionFile, QObject *parent)
     : QObject(parent)
     , m_collectionFile(collectionFile)
+    , m_fileDataCache(fileDataCacheSize)
 {
     const QFileInfo fi(m_collectionFile);
     if (!fi.isAbsolute())
@@ -79,6 +83,8 @@ bool QHelpCollectionHandler::isDBOpened() const
 
 void QHelpCollectionHandler::closeDB()
 {
+    clearFileDataCache();
+
     if (!m_query)
         return;
 
@@ -88,6 +94,13 @@ void QHelpCollectionHandler::closeDB()
     m_connectionName = QString();
 }
 
+void QHelpCollectionHandler::clearFileDataCache()
+{
+    m_fileDataCache.clear();
+    qDeleteAll(m_fileDataReaders);
+    m_fileDataReaders.clear();
+}
+
 QString QHelpCollectionHandler::collectionFile() const
 {
     return m_collectionFile;
@@ -862,6 +875,8 @@ bool QHelpCollectionHandler::registerDocumentation(const QString &fileName)
     if (!isDBOpened())
         return false;
 
+    clearFileDataCache();
+
     QHelpDBReader reader(fileName, QHelpGlobal::uniquifyConnectionName(
         QLatin1String("QHelpCollectionHandler"), this), nullptr);
     if (!reader.init()) {
@@ -899,6 +914,8 @@ bool QHelpCollectionHandler::unregisterDocumentation(const QString &namespaceNam
     if (!isDBOpened())
         return false;
 
+    clearFileDataCache();
+
     m_query->prepare(QLatin1String("SELECT Id FROM NamespaceTable WHERE Name = ?"));
     m_query->bindValue(0, namespaceName);
     m_query->exec();
@@ -1358,15 +1375,32 @@ QByteArray QHelpCollectionHandler::fileData(const QUrl &url) const
 
     const FileInfo fileInfo = extractFileInfo(url);
 
-    const FileInfo docInfo = registeredDocumentation(namespaceName);
-    const QString absFileName = absoluteDocPath(docInfo.fileName);
-
-    QHelpDBReader reader(absFileName, QHelpGlobal::uniquifyConnectionName(
-                             docInfo.fileName, const_cast<QHelpCollectionHandler *>(this)), nullptr);
-    if (!reader.init())
-        return QByteArray();
+    const QString cacheKey = namespaceName + QLatin1Char('/')
+            + fileInfo.folderName + QLatin1Char('/') + fileInfo.fileName;
+    if (const QByteArray *data = m_fileDataCache.object(cacheKey))
+        return *data;
+
+    // Keep one open reader per documentation file, so that loading a
+    // page and its images does not reopen the database for every file.
+    QHelpDBReader *reader = m_fileDataReaders.value(namespaceName);
+    if (!reader) {
+        const FileInfo docInfo = registeredDocumentation(namespaceName);
+        const QString absFileName = absoluteDocPath(docInfo.fileName);
+
+        auto that = const_cast<QHelpCollectionHandler *>(this);
+        reader = new QHelpDBReader(absFileName, QHelpGlobal::uniquifyConnectionName(
+                                       docInfo.fileName, that), that);
+        if (!reader->init()) {
+            delete reader;
+            return QByteArray();
+        }
+        m_fileDataReaders.insert(namespaceName, reader);
+    }
 
-    return reader.fileData(fileInfo.folderName, fileInfo.fileName);
+    const QByteArray data = reader->fileData(fileInfo.folderName, fileInfo.fileName);
+    if (!data.isEmpty() && data.size() <= m_fileDataCache.maxCost())
+        m_fileDataCache.insert(cacheKey, new QByteArray(data), data.size());
+    return data;
 }
 
 QStringList QHelpCollectionHandler::indicesForFilter(const QStringList &filterAttributes) const
@@ -15,6 +15,8 @@
 // We mean it.
 //
 
+#include <QtCore/QCache>
+#include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QString>
 #include <QtCore/QObject>
@@ -138,6 +140,7 @@ public:
 
 
     FileInfo registeredDocumentation(const QString &namespaceName) const;
+    QString absoluteDocPath(const QString &fileName) const;
     FileInfoList registeredDocumentations() const;
     bool registerDocumentation(const QString &fileName);
     bool unregisterDocumentation(const QString &namespaceName);
@@ -202,6 +205,7 @@ private:
     bool isDBOpened() const;
     bool createTables(QSqlQuery *query);
     void closeDB();
+    void clearFileDataCache();
     bool recreateIndexAndNamespaceFilterTables(QSqlQuery *query);
     bool registerIndexAndNamespaceFilterTables(const QString &nameSpace,
                                                bool createDefaultVersionFilter = false);
@@ -211,7 +215,6 @@ private:
     bool registerIndexTable(const QHelpDBReader::IndexTable &indexTable,
                             int nsId, int vfId, const QString &fileName);
     bool unregisterIndexTable(int nsId, int vfId);
-    QString absoluteDocPath(const QString &fileName) const;
     bool isTimeStampCorrect(const TimeStamp &timeStamp) const;
     bool hasTimeStampInfo(const QString &nameSpace) const;
     void scheduleVacuum();
@@ -222,6 +225,8 @@ private:
     QSqlQuery *m_query = nullptr;
     bool m_vacuumScheduled = false;
     bool m_readOnly = true;
+    mutable QHash<QString, QHelpDBReader *> m_fileDataReaders;
+    mutable QCache<QString, QByteArray> m_fileDataCache;
 };
 
 QT_END_NAMESPACE
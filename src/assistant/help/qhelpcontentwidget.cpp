@@ -4,6 +4,7 @@
 #include "qhelpcontentwidget.h"
 #include "qhelpenginecore.h"
 #include "qhelpengine_p.h"
+#include "qhelpcollectioncache_p.h"
 #include "qhelpcollectionhandler_p.h"
 
 #include <QDir>
@@ -243,9 +244,17 @@ void QHelpContentProvider::run()
     QHelpContentItem *item = nullptr;
     QHelpContentItem * const rootItem = new QHelpContentItem(QString(), QString(), nullptr);
 
-    const QList<QHelpCollectionHandler::ContentsData> result = usesFilterEngine
-            ? collectionHandler.contentsForFilter(currentFilter)
-            : collectionHandler.contentsForFilter(attributes);
+    const QHelpCollectionCache cache = usesFilterEngine
+            ? QHelpCollectionCache(collectionHandler, currentFilter)
+            : QHelpCollectionCache(collectionHandler, attributes);
+
+    QList<QHelpCollectionHandler::ContentsData> result;
+    if (!cache.readContents(&result)) {
+        result = usesFilterEngine
+                ? collectionHandler.contentsForFilter(currentFilter)
+                : collectionHandler.contentsForFilter(attributes);
+        cache.writeContents(result);
+    }
 
     for (const auto &contentsData : result) {
         m_mutex.lock();
@@ -32,6 +32,7 @@ QHelpDBReader::QHelpDBReader(const QString &dbName, const QString &uniqueId,
 QHelpDBReader::~QHelpDBReader()
 {
     if (m_initDone) {
+        delete m_fileDataQuery;
         delete m_query;
         QSqlDatabase::removeDatabase(m_uniqueId);
     }
@@ -385,27 +386,33 @@ QByteArray QHelpDBReader::fileData(const QString &virtualFolder,
         return ba;
 
     namespaceName();
-    m_query->prepare(QLatin1String(
-                    "SELECT "
-                        "FileDataTable.Data "
-                    "FROM "
-                        "FileDataTable, "
-                        "FileNameTable, "
-                        "FolderTable, "
-                        "NamespaceTable "
-                    "WHERE FileDataTable.Id = FileNameTable.FileId "
-                    "AND (FileNameTable.Name = ? OR FileNameTable.Name = ?) "
-                    "AND FileNameTable.FolderId = FolderTable.Id "
-                    "AND FolderTable.Name = ? "
-                    "AND FolderTable.NamespaceId = NamespaceTable.Id "
-                    "AND NamespaceTable.Name = ?"));
-    m_query->bindValue(0, filePath);
-    m_query->bindValue(1, QString(QLatin1String("./") + filePath));
-    m_query->bindValue(2, virtualFolder);
-    m_query->bindValue(3, m_namespace);
-    m_query->exec();
-    if (m_query->next() && m_query->isValid())
-        ba = qUncompress(m_query->value(0).toByteArray());
+    // The statement is prepared once and kept, since viewers call
+    // this for every image and style sheet of a page.
+    if (!m_fileDataQuery) {
+        m_fileDataQuery = new QSqlQuery(QSqlDatabase::database(m_uniqueId));
+        m_fileDataQuery->prepare(QLatin1String(
+                        "SELECT "
+                            "FileDataTable.Data "
+                        "FROM "
+                            "FileDataTable, "
+                            "FileNameTable, "
+                            "FolderTable, "
+                            "NamespaceTable "
+                        "WHERE FileDataTable.Id = FileNameTable.FileId "
+                        "AND (FileNameTable.Name = ? OR FileNameTable.Name = ?) "
+                        "AND FileNameTable.FolderId = FolderTable.Id "
+                        "AND FolderTable.Name = ? "
+                        "AND FolderTable.NamespaceId = NamespaceTable.Id "
+                        "AND NamespaceTable.Name = ?"));
+    }
+    m_fileDataQuery->bindValue(0, filePath);
+    m_fileDataQuery->bindValue(1, QString(QLatin1String("./") + filePath));
+    m_fileDataQuery->bindValue(2, virtualFolder);
+    m_fileDataQuery->bindValue(3, m_namespace);
+    m_fileDataQuery->exec();
+    if (m_fileDataQuery->next() && m_fileDataQuery->isValid())
+        ba = qUncompress(m_fileDataQuery->value(0).toByteArray());
+    m_fileDataQuery->finish();
     return ba;
 }
 
@@ -447,7 +454,8 @@ QStringList QHelpDBReader::filterAttributes(const QString &filterName) const
 }
 
 QMultiMap<QString, QByteArray> QHelpDBReader::filesData(const QStringList &filterAttributes,
-                                                        const QString &extensionFilter) const
+                                                        const QString &extensionFilter,
+                                                        bool uncompress) const
 {
     QMultiMap<QString, QByteArray> result;
     if (!m_query)
@@ -494,8 +502,10 @@ QMultiMap<QString, QByteArray> QHelpDBReader::filesData(const QStringList &filte
         }
     }
     m_query->exec(query);
-    while (m_query->next())
-        result.insert(m_query->value(0).toString(), qUncompress(m_query->value(1).toByteArray()));
+    while (m_query->next()) {
+        const QByteArray data = m_query->value(1).toByteArray();
+        result.insert(m_query->value(0).toString(), uncompress ? qUncompress(data) : data);
+    }
 
     return result;
 }
@@ -80,7 +80,8 @@ public:
     IndexTable indexTable() const;
     QList<QStringList> filterAttributeSets() const;
     QMultiMap<QString, QByteArray> filesData(const QStringList &filterAttributes,
-                                             const QString &extensionFilter = QString()) const;
+                                             const QString &extensionFilter = QString(),
+                                             bool uncompress = true) const;
     QByteArray fileData(const QString &virtualFolder,
         const QString &filePath) const;
 
@@ -99,6 +100,7 @@ private:
     QString m_uniqueId;
     QString m_error;
     QSqlQuery *m_query = nullptr;
+    mutable QSqlQuery *m_fileDataQuery = nullptr;
     mutable QString m_namespace;
 };
 
@@ -0,0 +1,319 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qhelphtmltextextractor_p.h"
+#include "qhelphtmlentities_p.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QStringConverter>
+
+#include <algorithm>
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// Tags that start a new line of text.
+const char *const blockTags[] = {
+    "address", "article", "blockquote", "br", "caption", "dd", "div", "dl", "dt",
+    "figure", "footer", "h1", "h2", "h3", "h4", "h5", "h6", "header", "hr", "li",
+    "nav", "ol", "p", "pre", "section", "table", "tbody", "thead", "tr", "ul"
+};
+
+bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+bool isNameChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+bool tagIs(QByteArrayView name, const char *tag)
+{
+    const size_t length = std::strlen(tag);
+    return size_t(name.size()) == length && qstrnicmp(name.data(), tag, length) == 0;
+}
+
+// Collects UTF-8 text, collapsing whitespace and separators between
+// elements into a single space or newline.
+class TextSink
+{
+public:
+    void append(char c)
+    {
+        flushSeparator();
+        m_data.append(c);
+    }
+
+    void append(char32_t codePoint)
+    {
+        if (codePoint == U' ') {
+            separate(' ');
+            return;
+        }
+        flushSeparator();
+        if (codePoint < 0x80) {
+            m_data.append(char(codePoint));
+        } else if (codePoint < 0x800) {
+            m_data.append(char(0xc0 | (codePoint >> 6)));
+            m_data.append(char(0x80 | (codePoint & 0x3f)));
+        } else if (codePoint < 0x10000) {
+            m_data.append(char(0xe0 | (codePoint >> 12)));
+            m_data.append(char(0x80 | ((codePoint >> 6) & 0x3f)));
+            m_data.append(char(0x80 | (codePoint & 0x3f)));
+        } else {
+            m_data.append(char(0xf0 | (codePoint >> 18)));
+            m_data.append(char(0x80 | ((codePoint >> 12) & 0x3f)));
+            m_data.append(char(0x80 | ((codePoint >> 6) & 0x3f)));
+            m_data.append(char(0x80 | (codePoint & 0x3f)));
+        }
+    }
+
+    void separate(char separator)
+    {
+        if (!m_data.isEmpty() && m_separator != '\n')
+            m_separator = separator;
+    }
+
+    QString toString() const { return QString::fromUtf8(m_data); }
+
+private:
+    void flushSeparator()
+    {
+        if (m_separator) {
+            m_data.append(m_separator);
+            m_separator = 0;
+        }
+    }
+
+    QByteArray m_data;
+    char m_separator = 0;
+};
+
+// Decodes the entity starting at the '&' in \a p into one or two code
+// points; the second one is 0 if unused. Returns the position after the
+// entity, or after the '&' if there is no known entity. &nbsp; becomes a
+// plain space, like in QTextDocument::toPlainText().
+const char *decodeEntity(const char *p, const char *end, char32_t codePoints[2])
+{
+    const char *nameStart = p + 1;
+    const char *limit = std::min(end, nameStart + sizeof(QHelpHtmlEntity::name));
+    const char *semicolon = std::find(nameStart, limit, ';');
+    codePoints[0] = U'&';
+    codePoints[1] = 0;
+    if (semicolon == limit)
+        return nameStart;
+
+    const QByteArrayView name(nameStart, semicolon);
+    if (name.startsWith('#')) {
+        bool ok = false;
+        uint value;
+        if (name.size() > 1 && (name.at(1) == 'x' || name.at(1) == 'X'))
+            value = name.sliced(2).toUInt(&ok, 16);
+        else
+            value = name.sliced(1).toUInt(&ok, 10);
+        if (!ok)
+            return nameStart;
+        if (value == 0 || value > 0x10ffff || (value >= 0xd800 && value <= 0xdfff))
+            value = 0xfffd;
+        else if (value == 0xa0)
+            value = U' ';
+        codePoints[0] = value;
+        return semicolon + 1;
+    }
+
+    const auto entity = std::lower_bound(std::begin(qHelpHtmlEntities),
+                                         std::end(qHelpHtmlEntities), name,
+                                         [](const QHelpHtmlEntity &candidate, QByteArrayView name) {
+        return QByteArrayView(candidate.name) < name;
+    });
+    if (entity == std::end(qHelpHtmlEntities) || name != QByteArrayView(entity->name))
+        return nameStart;
+    codePoints[0] = entity->codePoints[0] == 0xa0 ? U' ' : entity->codePoints[0];
+    codePoints[1] = entity->codePoints[1];
+    return semicolon + 1;
+}
+
+// Returns the position of the end of the tag starting at \a p, skipping
+// quoted attribute values.
+const char *findTagEnd(const char *p, const char *end)
+{
+    char quote = 0;
+    for (; p < end; ++p) {
+        if (quote) {
+            if (*p == quote)
+                quote = 0;
+        } else if (*p == '"' || *p == '\'') {
+            quote = *p;
+        } else if (*p == '>') {
+            return p + 1;
+        }
+    }
+    return end;
+}
+
+// Returns the position after the closing tag for the raw text element
+// \a name, searching from \a p.
+const char *skipRawText(const char *p, const char *end, QByteArrayView name)
+{
+    for (; p < end; ++p) {
+        if (*p != '<' || end - p < name.size() + 3 || p[1] != '/')
+            continue;
+        if (qstrnicmp(p + 2, name.data(), name.size()) == 0
+                && !isNameChar(p[2 + name.size()])) {
+            return findTagEnd(p, end);
+        }
+    }
+    return end;
+}
+
+} // namespace
+
+/*!
+    \internal
+
+    Extracts the title and the plain text of the page \a html in a
+    single pass over its bytes. The encoding is detected with
+    QStringDecoder::encodingForHtml(); only pages that are not UTF-8
+    are decoded and reencoded first.
+*/
+QHelpHtmlTextExtractor QHelpHtmlTextExtractor::fromHtml(const QByteArray &html, Mode mode)
+{
+    QHelpHtmlTextExtractor extractor;
+    const auto encoding = QStringDecoder::encodingForHtml(html);
+    if (!encoding || *encoding == QStringConverter::Utf8) {
+        QByteArrayView data(html);
+        if (data.startsWith("\xef\xbb\xbf"))
+            data = data.sliced(3);
+        extractor.extract(data, mode);
+    } else {
+        QStringDecoder decoder(*encoding);
+        const QString decoded = decoder(html);
+        extractor.extract(decoded.toUtf8(), mode);
+    }
+    return extractor;
+}
+
+/*!
+    \internal
+
+    Extracts the title and the plain text of the UTF-8 encoded page \a html.
+*/
+QHelpHtmlTextExtractor QHelpHtmlTextExtractor::fromUtf8(QByteArrayView html, Mode mode)
+{
+    QHelpHtmlTextExtractor extractor;
+    extractor.extract(html, mode);
+    return extractor;
+}
+
+/*!
+    \internal
+
+    Returns the title of the page, or "Untitled" if it has none.
+*/
+QString QHelpHtmlTextExtractor::documentTitle() const
+{
+    if (m_title.isEmpty())
+        return QCoreApplication::translate("QHelp", "Untitled");
+    return m_title;
+}
+
+void QHelpHtmlTextExtractor::extract(QByteArrayView html, Mode mode)
+{
+    TextSink title;
+    TextSink text;
+    bool inHead = false;
+    bool inTitle = false;
+    bool titleDone = false;
+
+    const char *p = html.data();
+    const char *end = p + html.size();
+    while (p < end) {
+        TextSink *sink = inTitle ? &title
+                                 : (inHead || mode == TitleOnly ? nullptr : &text);
+        const char c = *p;
+        if (c == '&') {
+            char32_t codePoints[2];
+            p = decodeEntity(p, end, codePoints);
+            if (sink) {
+                sink->append(codePoints[0]);
+                if (codePoints[1])
+                    sink->append(codePoints[1]);
+            }
+            continue;
+        }
+        if (c != '<') {
+            if (sink) {
+                if (isSpace(c))
+                    sink->separate(' ');
+                else
+                    sink->append(c);
+            }
+            ++p;
+            continue;
+        }
+
+        if (end - p >= 4 && std::memcmp(p, "<!--", 4) == 0) {
+            const char *commentEnd = std::search(p + 4, end, "-->", "-->" + 3);
+            p = commentEnd == end ? end : commentEnd + 3;
+            continue;
+        }
+        if (end - p >= 2 && (p[1] == '!' || p[1] == '?')) {
+            p = findTagEnd(p, end);
+            continue;
+        }
+
+        const bool closing = end - p >= 2 && p[1] == '/';
+        const char *nameStart = p + (closing ? 2 : 1);
+        const char *nameEnd = nameStart;
+        while (nameEnd < end && isNameChar(*nameEnd))
+            ++nameEnd;
+        if (nameEnd == nameStart) {
+            // Not a tag, just a '<' in the text.
+            if (sink)
+                sink->append(c);
+            ++p;
+            continue;
+        }
+
+        const QByteArrayView name(nameStart, nameEnd);
+        p = findTagEnd(nameEnd, end);
+
+        if (tagIs(name, "title")) {
+            if (!closing && !titleDone) {
+                inTitle = true;
+            } else if (closing && inTitle) {
+                inTitle = false;
+                titleDone = true;
+                if (mode == TitleOnly)
+                    break;
+            }
+        } else if (tagIs(name, "head")) {
+            inHead = !closing;
+        } else if (tagIs(name, "body")) {
+            inHead = false;
+        } else if (!closing && (tagIs(name, "script") || tagIs(name, "style"))) {
+            p = skipRawText(p, end, name);
+        } else if (sink) {
+            if (tagIs(name, "td") || tagIs(name, "th")) {
+                sink->separate(' ');
+            } else {
+                for (const char *blockTag : blockTags) {
+                    if (tagIs(name, blockTag)) {
+                        sink->separate('\n');
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    m_title = title.toString();
+    if (mode == TitleAndText)
+        m_text = text.toString();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,51 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QHELPHTMLTEXTEXTRACTOR_H
+#define QHELPHTMLTEXTEXTRACTOR_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists for the convenience
+// of the help generator tools. This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qhelp_global.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
+#include <QtCore/QString>
+
+QT_BEGIN_NAMESPACE
+
+class QHELP_EXPORT QHelpHtmlTextExtractor
+{
+public:
+    enum Mode {
+        TitleAndText,
+        TitleOnly
+    };
+
+    static QHelpHtmlTextExtractor fromHtml(const QByteArray &html, Mode mode = TitleAndText);
+    static QHelpHtmlTextExtractor fromUtf8(QByteArrayView html, Mode mode = TitleAndText);
+
+    QString title() const { return m_title; }
+    QString text() const { return m_text; }
+    QString documentTitle() const;
+
+private:
+    QHelpHtmlTextExtractor() = default;
+    void extract(QByteArrayView html, Mode mode);
+
+    QString m_title;
+    QString m_text;
+};
+
+QT_END_NAMESPACE
+
+#endif // QHELPHTMLTEXTEXTRACTOR_H
@@ -5,8 +5,10 @@
 #include "qhelpenginecore.h"
 #include "qhelpengine_p.h"
 #include "qhelpdbreader_p.h"
+#include "qhelpcollectioncache_p.h"
 #include "qhelpcollectionhandler_p.h"
 
+#include <QtCore/QHash>
 #include <QtCore/QThread>
 #include <QtCore/QMutex>
 #include <QtHelp/QHelpLink>
@@ -14,9 +16,65 @@
 #include <QtWidgets/QHeaderView>
 
 #include <algorithm>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
+namespace {
+
+// Case-folded copies of the keywords, and for each trigram of them the
+// ascending list of keywords that contain it.
+struct QHelpIndexSearchData
+{
+    void build(const QStringList &indices);
+    const QList<int> *candidates(const QString &foldedFilter) const;
+
+    QStringList foldedIndices;
+    QHash<quint64, QList<int>> trigrams;
+};
+
+quint64 trigramKey(const QChar *c)
+{
+    return (quint64(c[0].unicode()) << 32) | (quint64(c[1].unicode()) << 16) | c[2].unicode();
+}
+
+void QHelpIndexSearchData::build(const QStringList &indices)
+{
+    foldedIndices.clear();
+    foldedIndices.reserve(indices.size());
+    trigrams.clear();
+    for (int i = 0; i < indices.size(); ++i) {
+        const QString folded = indices.at(i).toCaseFolded();
+        for (qsizetype j = 0; j + 3 <= folded.size(); ++j) {
+            QList<int> &postings = trigrams[trigramKey(folded.constData() + j)];
+            if (postings.isEmpty() || postings.last() != i)
+                postings.append(i);
+        }
+        foldedIndices.append(folded);
+    }
+}
+
+/*
+    Returns the shortest posting list among the trigrams of \a foldedFilter,
+    or nullptr if the filter is too short to have any. An empty list is
+    returned when some trigram does not occur at all.
+*/
+const QList<int> *QHelpIndexSearchData::candidates(const QString &foldedFilter) const
+{
+    static const QList<int> noCandidates;
+    const QList<int> *shortest = nullptr;
+    for (qsizetype j = 0; j + 3 <= foldedFilter.size(); ++j) {
+        const auto it = trigrams.constFind(trigramKey(foldedFilter.constData() + j));
+        if (it == trigrams.cend())
+            return &noCandidates;
+        if (!shortest || it->size() < shortest->size())
+            shortest = &it.value();
+    }
+    return shortest;
+}
+
+} // namespace
+
 class QHelpIndexProvider : public QThread
 {
 public:
@@ -25,6 +83,7 @@ public:
     void collectIndices(const QString &customFilterName);
     void stopCollecting();
     QStringList indices() const;
+    QHelpIndexSearchData searchData() const;
 
 private:
     void run() override;
@@ -33,6 +92,7 @@ private:
     QString m_currentFilter;
     QStringList m_filterAttributes;
     QStringList m_indices;
+    QHelpIndexSearchData m_searchData;
     mutable QMutex m_mutex;
 };
 
@@ -48,6 +108,11 @@ public:
     QHelpEnginePrivate *helpEngine;
     QHelpIndexProvider *indexProvider;
     QStringList indices;
+    QHelpIndexSearchData searchData;
+    // The last plain filter, case folded, and the keywords it matched.
+    // A filter containing it can only match a subset of these.
+    QString lastFilter;
+    QList<int> lastMatches;
 };
 
 QHelpIndexProvider::QHelpIndexProvider(QHelpEnginePrivate *helpEngine)
@@ -86,6 +151,12 @@ QStringList QHelpIndexProvider::indices() const
     return m_indices;
 }
 
+QHelpIndexSearchData QHelpIndexProvider::searchData() const
+{
+    QMutexLocker lck(&m_mutex);
+    return m_searchData;
+}
+
 void QHelpIndexProvider::run()
 {
     m_mutex.lock();
@@ -93,6 +164,7 @@ void QHelpIndexProvider::run()
     const QStringList attributes = m_filterAttributes;
     const QString collectionFile = m_helpEngine->collectionHandler->collectionFile();
     m_indices = QStringList();
+    m_searchData = QHelpIndexSearchData();
     m_mutex.unlock();
 
     if (collectionFile.isEmpty())
@@ -102,12 +174,25 @@ void QHelpIndexProvider::run()
     if (!collectionHandler.openCollectionFile())
         return;
 
-    const QStringList result = m_helpEngine->usesFilterEngine
-            ? collectionHandler.indicesForFilter(currentFilter)
-            : collectionHandler.indicesForFilter(attributes);
+    const bool usesFilterEngine = m_helpEngine->usesFilterEngine;
+    const QHelpCollectionCache cache = usesFilterEngine
+            ? QHelpCollectionCache(collectionHandler, currentFilter)
+            : QHelpCollectionCache(collectionHandler, attributes);
+
+    QStringList result;
+    if (!cache.readIndices(&result)) {
+        result = usesFilterEngine
+                ? collectionHandler.indicesForFilter(currentFilter)
+                : collectionHandler.indicesForFilter(attributes);
+        cache.writeIndices(result);
+    }
+
+    QHelpIndexSearchData searchData;
+    searchData.build(result);
 
     m_mutex.lock();
     m_indices = result;
+    m_searchData = searchData;
     m_mutex.unlock();
 }
 
@@ -163,6 +248,7 @@ void QHelpIndexModel::createIndex(const QString &customFilterName)
         return;
 
     d->indices = QStringList();
+    d->searchData = QHelpIndexSearchData();
     filter(QString());
     emit indexCreationStarted();
 }
@@ -173,6 +259,7 @@ void QHelpIndexModel::insertIndices()
         return;
 
     d->indices = d->indexProvider->indices();
+    d->searchData = d->indexProvider->searchData();
     filter(QString());
     emit indexCreated();
 }
@@ -208,6 +295,9 @@ QHelpEngineCore *QHelpIndexModel::helpEngine() const
 */
 QModelIndex QHelpIndexModel::filter(const QString &filter, const QString &wildcard)
 {
+    const QString previousFilter = std::exchange(d->lastFilter, QString());
+    const QList<int> previousMatches = std::exchange(d->lastMatches, QList<int>());
+
     if (filter.isEmpty()) {
         setStringList(d->indices);
         return index(-1, 0, QModelIndex());
@@ -236,21 +326,40 @@ QModelIndex QHelpIndexModel::filter(const QString &filter, const QString &wildca
             }
         }
     } else {
-        for (const QString &index : qAsConst(d->indices)) {
-            if (index.contains(filter, Qt::CaseInsensitive)) {
-                lst.append(index);
-                if (perfectMatch == -1 && index.startsWith(filter, Qt::CaseInsensitive)) {
-                    if (goodMatch == -1)
-                        goodMatch = lst.count() - 1;
-                    if (filter.length() == index.length()){
-                        perfectMatch = lst.count() - 1;
-                    }
-                } else if (perfectMatch > -1 && index == filter) {
+        // Only look at the keywords matched by the previous filter if
+        // this one extends it, or else at those sharing its rarest trigram.
+        const QString foldedFilter = filter.toCaseFolded();
+        const QList<int> *candidates = nullptr;
+        if (!previousFilter.isEmpty() && foldedFilter.contains(previousFilter))
+            candidates = &previousMatches;
+        else
+            candidates = d->searchData.candidates(foldedFilter);
+
+        auto checkIndex = [&](int i) {
+            if (!d->searchData.foldedIndices.at(i).contains(foldedFilter))
+                return;
+            const QString &index = d->indices.at(i);
+            d->lastMatches.append(i);
+            lst.append(index);
+            if (perfectMatch == -1 && index.startsWith(filter, Qt::CaseInsensitive)) {
+                if (goodMatch == -1)
+                    goodMatch = lst.count() - 1;
+                if (filter.length() == index.length()){
                     perfectMatch = lst.count() - 1;
                 }
+            } else if (perfectMatch > -1 && index == filter) {
+                perfectMatch = lst.count() - 1;
             }
+        };
+
+        if (candidates) {
+            for (int i : *candidates)
+                checkIndex(i);
+        } else {
+            for (int i = 0; i < d->indices.size(); ++i)
+                checkIndex(i);
         }
-
+        d->lastFilter = foldedFilter;
     }
 
     if (perfectMatch == -1)
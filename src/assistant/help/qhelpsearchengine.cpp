@@ -455,6 +455,10 @@ QList<QHelpSearchEngine::SearchHit> QHelpSearchEngine::hits(int start, int end)
     \since 5.9
     Returns a list of search results within the range from the index
     specified by \a start to the index specified by \a end.
+
+    The result snippets are only generated for the requested range, so
+    requesting one page of results at a time is cheap even when the
+    search matched many documents.
 */
 QList<QHelpSearchResult> QHelpSearchEngine::searchResults(int start, int end) const
 {
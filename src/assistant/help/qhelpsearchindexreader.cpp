@@ -44,9 +44,16 @@ QList<QHelpSearchResult> QHelpSearchIndexReader::searchResults(int start,
                                                                  int end) const
 {
     QMutexLocker lock(&m_mutex);
+    completeSearchResults(start, end);
     return m_searchResults.mid(start, end - start);
 }
 
+void QHelpSearchIndexReader::completeSearchResults(int start, int end) const
+{
+    Q_UNUSED(start);
+    Q_UNUSED(end);
+}
+
 
 }   // namespace fulltextsearch
 
@@ -5,6 +5,8 @@
 #include "qhelpfilterengine.h"
 #include "qhelpsearchindexreader_default_p.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QMap>
 #include <QtCore/QSet>
 #include <QtSql/QSqlDatabase>
 #include <QtSql/QSqlQuery>
@@ -99,16 +101,17 @@ static void bindNamespacesAndAttributes(QSqlQuery *query, const QStringList &nam
         query->addBindValue(ns);
 }
 
-QList<QHelpSearchResult> Reader::queryTable(const QSqlDatabase &db,
-                                         const QString &tableName,
-                                         const QString &searchInput) const
+QList<Reader::SearchHit> Reader::queryTable(const QSqlDatabase &db,
+                                           const QString &tableName,
+                                           const QString &searchInput) const
 {
     const QString nsPlaceholders = m_useFilterEngine
             ? namespacePlaceholders(m_filterEngineNamespaceList)
             : namespacePlaceholders(m_namespaceAttributes);
+    // Snippets are expensive, so they are only made for the results
+    // that are actually requested, see fetchSnippets().
     QSqlQuery query(db);
-    query.prepare(QLatin1String("SELECT url, title, snippet(") + tableName +
-                  QLatin1String(", -1, '<b>', '</b>', '...', '10') FROM ") + tableName +
+    query.prepare(QLatin1String("SELECT rowid, url, title FROM ") + tableName +
                   QLatin1String(" WHERE (") + nsPlaceholders +
                   QLatin1String(") AND ") + tableName +
                   QLatin1String(" MATCH ? ORDER BY rank"));
@@ -118,16 +121,18 @@ QList<QHelpSearchResult> Reader::queryTable(const QSqlDatabase &db,
     query.addBindValue(searchInput);
     query.exec();
 
-    QList<QHelpSearchResult> results;
+    QList<SearchHit> hits;
 
     while (query.next()) {
-        const QString &url = query.value(QLatin1String("url")).toString();
-        const QString &title = query.value(QLatin1String("title")).toString();
-        const QString &snippet = query.value(2).toString();
-        results.append(QHelpSearchResult(url, title, snippet));
+        SearchHit hit;
+        hit.rowId = query.value(0).toLongLong();
+        hit.url = query.value(1).toString();
+        hit.title = query.value(2).toString();
+        hit.tableName = tableName;
+        hits.append(hit);
     }
 
-    return results;
+    return hits;
 }
 
 void Reader::searchInDB(const QString &searchInput)
@@ -139,29 +144,25 @@ void Reader::searchInDB(const QString &searchInput)
         db.setDatabaseName(m_indexPath + QLatin1String("/fts"));
 
         if (db.open()) {
-            const QList<QHelpSearchResult> titleResults = queryTable(db,
+            const QList<SearchHit> titleHits = queryTable(db,
                                              QLatin1String("titles"), searchInput);
-            const QList<QHelpSearchResult> contentResults = queryTable(db,
+            const QList<SearchHit> contentHits = queryTable(db,
                                              QLatin1String("contents"), searchInput);
 
             // merge results form title and contents searches
             m_searchResults = QList<QHelpSearchResult>();
+            m_searchHits = QList<SearchHit>();
 
             QSet<QUrl> urls;
 
-            for (const QHelpSearchResult &result : titleResults) {
-                const QUrl &url = result.url();
-                if (!urls.contains(url)) {
-                    urls.insert(url);
-                    m_searchResults.append(result);
-                }
-            }
-
-            for (const QHelpSearchResult &result : contentResults) {
-                const QUrl &url = result.url();
-                if (!urls.contains(url)) {
-                    urls.insert(url);
-                    m_searchResults.append(result);
+            for (const QList<SearchHit> *hits : { &titleHits, &contentHits }) {
+                for (const SearchHit &hit : *hits) {
+                    const QUrl url(hit.url);
+                    if (!urls.contains(url)) {
+                        urls.insert(url);
+                        m_searchHits.append(hit);
+                        m_searchResults.append(QHelpSearchResult(url, hit.title, QString()));
+                    }
                 }
             }
         }
@@ -174,6 +175,118 @@ QList<QHelpSearchResult> Reader::searchResults() const
     return m_searchResults;
 }
 
+QList<Reader::SearchHit> Reader::searchHits() const
+{
+    return m_searchHits;
+}
+
+/*
+    Fills in the snippets of the results from \a start to \a end that do
+    not have one yet. Only the rows of these results are queried, one
+    query per table and per chunk of maxBoundRowIds rows, so the cost does
+    not depend on the total number of results and the number of bound
+    values stays below SQLITE_MAX_VARIABLE_NUMBER.
+
+    The index may have been rebuilt since the search, in which case a
+    rowid can be gone or belong to another page. Such rows are detected
+    by their URL and looked up again by URL instead.
+
+    This runs in the thread that asks for the results, which is usually
+    the GUI thread, with the mutex of the reader held; hence it is limited
+    to the requested page of results.
+*/
+void Reader::fetchSnippets(const QString &indexPath, const QString &searchInput,
+                           QList<SearchHit> *hits, QList<QHelpSearchResult> *results,
+                           int start, int end)
+{
+    static constexpr int maxBoundRowIds = 500;
+
+    start = qMax(start, 0);
+    end = qMin(end, int(qMin(hits->size(), results->size())));
+
+    QMap<QString, QList<int>> pending;
+    for (int i = start; i < end; ++i) {
+        if (!hits->at(i).snippetFetched)
+            pending[hits->at(i).tableName].append(i);
+    }
+    if (pending.isEmpty())
+        return;
+
+    const auto setSnippet = [hits, results](int i, const QString &snippet) {
+        const SearchHit &hit = hits->at(i);
+        (*results)[i] = QHelpSearchResult(QUrl(hit.url), hit.title, snippet);
+    };
+
+    const QString &uniqueId = QHelpGlobal::uniquifyConnectionName(
+                QLatin1String("QHelpReaderSnippets"), hits);
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase(QLatin1String("QSQLITE"), uniqueId);
+        db.setConnectOptions(QLatin1String("QSQLITE_OPEN_READONLY"));
+        db.setDatabaseName(indexPath + QLatin1String("/fts"));
+
+        if (db.open()) {
+            for (auto it = pending.cbegin(), itEnd = pending.cend(); it != itEnd; ++it) {
+                const QString &tableName = it.key();
+                const QList<int> &indexes = it.value();
+                const QString select = QLatin1String("SELECT rowid, url, snippet(") + tableName +
+                        QLatin1String(", -1, '<b>', '</b>', '...', '10') FROM ") + tableName +
+                        QLatin1String(" WHERE ") + tableName + QLatin1String(" MATCH ? AND ");
+                QList<int> stale;
+
+                for (qsizetype chunk = 0; chunk < indexes.size(); chunk += maxBoundRowIds) {
+                    const QList<int> chunkIndexes = indexes.mid(chunk, maxBoundRowIds);
+                    QHash<qint64, int> hitForRowId;
+                    QString rowPlaceholders;
+                    for (int i : chunkIndexes) {
+                        hitForRowId.insert(hits->at(i).rowId, i);
+                        if (!rowPlaceholders.isEmpty())
+                            rowPlaceholders += QLatin1String(", ");
+                        rowPlaceholders += QLatin1Char('?');
+                    }
+
+                    QSqlQuery query(db);
+                    query.prepare(select + QLatin1String("rowid IN (") + rowPlaceholders +
+                                  QLatin1Char(')'));
+                    query.addBindValue(searchInput);
+                    for (int i : chunkIndexes)
+                        query.addBindValue(hits->at(i).rowId);
+                    query.exec();
+
+                    while (query.next()) {
+                        const auto hit = hitForRowId.constFind(query.value(0).toLongLong());
+                        if (hit == hitForRowId.cend()
+                                || hits->at(*hit).url != query.value(1).toString()) {
+                            continue;
+                        }
+                        setSnippet(*hit, query.value(2).toString());
+                        hitForRowId.erase(hit);
+                    }
+                    stale += hitForRowId.values();
+                }
+
+                if (stale.isEmpty())
+                    continue;
+
+                QSqlQuery query(db);
+                query.prepare(select + QLatin1String("url = ? LIMIT 1"));
+                for (int i : qAsConst(stale)) {
+                    query.bindValue(0, searchInput);
+                    query.bindValue(1, hits->at(i).url);
+                    query.exec();
+                    if (query.next())
+                        setSnippet(i, query.value(2).toString());
+                }
+            }
+        }
+    }
+    QSqlDatabase::removeDatabase(uniqueId);
+
+    for (const QList<int> &indexes : qAsConst(pending)) {
+        for (int i : indexes)
+            (*hits)[i].snippetFetched = true;
+    }
+}
+
 static bool attributesMatchFilter(const QStringList &attributes,
                                   const QStringList &filter)
 {
@@ -240,11 +353,23 @@ void QHelpSearchIndexReaderDefault::run()
 
     lock.relock();
     m_searchResults = m_reader.searchResults();
+    m_searchHits = m_reader.searchHits();
+    m_resultsSearchInput = searchInput;
+    m_resultsIndexPath = indexPath;
     lock.unlock();
 
     emit searchingFinished(m_searchResults.count());
 }
 
+void QHelpSearchIndexReaderDefault::completeSearchResults(int start, int end) const
+{
+    if (m_searchHits.size() != m_searchResults.size())
+        return;
+
+    Reader::fetchSnippets(m_resultsIndexPath, m_resultsSearchInput,
+                          &m_searchHits, &m_searchResults, start, end);
+}
+
 }   // namespace std
 }   // namespace fulltextsearch
 
@@ -27,21 +27,36 @@ namespace qt {
 class Reader
 {
 public:
+    struct SearchHit
+    {
+        QString url;
+        QString title;
+        QString tableName;
+        qint64 rowId = 0;
+        bool snippetFetched = false;
+    };
+
     void setIndexPath(const QString &path);
     void addNamespaceAttributes(const QString &namespaceName, const QStringList &attributes);
     void setFilterEngineNamespaceList(const QStringList &namespaceList);
 
     void searchInDB(const QString &term);
     QList<QHelpSearchResult> searchResults() const;
+    QList<SearchHit> searchHits() const;
+
+    static void fetchSnippets(const QString &indexPath, const QString &searchInput,
+                              QList<SearchHit> *hits, QList<QHelpSearchResult> *results,
+                              int start, int end);
 
 private:
-    QList<QHelpSearchResult> queryTable(const QSqlDatabase &db,
-                                          const QString &tableName,
-                                          const QString &searchInput) const;
+    QList<SearchHit> queryTable(const QSqlDatabase &db,
+                                const QString &tableName,
+                                const QString &searchInput) const;
 
     QMultiMap<QString, QStringList> m_namespaceAttributes;
     QStringList m_filterEngineNamespaceList;
     QList<QHelpSearchResult> m_searchResults;
+    QList<SearchHit> m_searchHits;
     QString m_indexPath;
     bool m_useFilterEngine = false;
 };
@@ -53,9 +68,13 @@ class QHelpSearchIndexReaderDefault : public QHelpSearchIndexReader
 
 private:
     void run() override;
+    void completeSearchResults(int start, int end) const override;
 
 private:
     Reader m_reader;
+    mutable QList<Reader::SearchHit> m_searchHits;
+    QString m_resultsSearchInput;
+    QString m_resultsIndexPath;
 };
 
 }   // namespace std
@@ -47,8 +47,13 @@ signals:
     void searchingFinished(int searchResultCount);
 
 protected:
+    // Called with m_mutex locked before the results from start to end
+    // are returned, so that readers can fill in what is too expensive
+    // to compute for every result up front.
+    virtual void completeSearchResults(int start, int end) const;
+
     mutable QMutex m_mutex;
-    QList<QHelpSearchResult> m_searchResults;
+    mutable QList<QHelpSearchResult> m_searchResults;
     bool m_cancel = false;
     QString m_collectionFile;
     QString m_searchInput;
@@ -5,7 +5,9 @@
 #include "qhelp_global.h"
 #include "qhelpenginecore.h"
 #include "qhelpdbreader_p.h"
+#include "qhelphtmltextextractor_p.h"
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
 #include <QtCore/QDir>
@@ -19,7 +21,10 @@
 #include <QtSql/QSqlError>
 #include <QtSql/QSqlQuery>
 
-#include <QTextDocument>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -112,9 +117,19 @@ void Writer::init(bool reindex)
         query.exec(QLatin1String("DROP TABLE titles;"));
         query.exec(QLatin1String("DROP TABLE contents;"));
         query.exec(QLatin1String("DROP TABLE info;"));
+        query.exec(QLatin1String("DROP TABLE dochashes;"));
     }
 
     query.exec(QLatin1String("CREATE TABLE info (id INTEGER PRIMARY KEY, namespace, attributes, url, title, data);"));
+    query.exec(QLatin1String("CREATE INDEX IF NOT EXISTS info_url ON info (url);"));
+
+    // Hashes of the compressed documents, so that an updated
+    // namespace only needs its changed documents reindexed.
+    query.exec(QLatin1String("CREATE TABLE IF NOT EXISTS dochashes ("
+                             "namespace, attributes, url, hash, "
+                             "PRIMARY KEY (attributes, url));"));
+    query.exec(QLatin1String("CREATE INDEX IF NOT EXISTS dochashes_namespace "
+                             "ON dochashes (namespace);"));
 
     query.exec(QLatin1String("CREATE VIRTUAL TABLE titles USING fts5("
                              "namespace UNINDEXED, attributes UNINDEXED, "
@@ -181,11 +196,23 @@ void Writer::flush()
     query.addBindValue(m_contents);
     query.execBatch();
 
+    query.prepare(QLatin1String("INSERT OR REPLACE INTO dochashes (namespace, attributes, url, hash) "
+                                "VALUES (?, ?, ?, ?)"));
+    query.addBindValue(m_namespaces);
+    query.addBindValue(m_attributes);
+    query.addBindValue(m_urls);
+    query.addBindValue(m_hashes);
+    query.execBatch();
+
+    if (!m_urls.isEmpty())
+        m_needMerge = true;
+
     m_namespaces = QVariantList();
     m_attributes = QVariantList();
     m_urls = QVariantList();
     m_titles = QVariantList();
     m_contents = QVariantList();
+    m_hashes = QVariantList();
 }
 
 void Writer::removeNamespace(const QString &namespaceName)
@@ -203,6 +230,10 @@ void Writer::removeNamespace(const QString &namespaceName)
     query.prepare(QLatin1String("DELETE FROM info WHERE namespace = ?"));
     query.addBindValue(namespaceName);
     query.exec();
+
+    query.prepare(QLatin1String("DELETE FROM dochashes WHERE namespace = ?"));
+    query.addBindValue(namespaceName);
+    query.exec();
 }
 
 bool Writer::hasNamespace(const QString &namespaceName)
@@ -219,17 +250,77 @@ bool Writer::hasNamespace(const QString &namespaceName)
     return query.next();
 }
 
+bool Writer::hasDocumentHashes(const QString &namespaceName)
+{
+    if (!m_db)
+        return false;
+
+    QSqlQuery query(*m_db);
+
+    query.prepare(QLatin1String("SELECT hash FROM dochashes WHERE namespace = ? LIMIT 1"));
+    query.addBindValue(namespaceName);
+    query.exec();
+
+    return query.next();
+}
+
+static QString documentKey(const QString &attributes, const QString &url)
+{
+    return attributes + QLatin1Char('\n') + url;
+}
+
+QHash<QString, QByteArray> Writer::documentHashes(const QString &namespaceName)
+{
+    QHash<QString, QByteArray> hashes;
+    if (!m_db)
+        return hashes;
+
+    QSqlQuery query(*m_db);
+
+    query.prepare(QLatin1String("SELECT attributes, url, hash FROM dochashes WHERE namespace = ?"));
+    query.addBindValue(namespaceName);
+    query.exec();
+
+    while (query.next()) {
+        hashes.insert(documentKey(query.value(0).toString(), query.value(1).toString()),
+                      query.value(2).toByteArray());
+    }
+    return hashes;
+}
+
+void Writer::removeDocument(const QString &attributes, const QString &url)
+{
+    if (!m_db)
+        return;
+
+    m_needMerge = true;
+
+    QSqlQuery query(*m_db);
+
+    query.prepare(QLatin1String("DELETE FROM info WHERE url = ? AND attributes = ?"));
+    query.addBindValue(url);
+    query.addBindValue(attributes);
+    query.exec();
+
+    query.prepare(QLatin1String("DELETE FROM dochashes WHERE url = ? AND attributes = ?"));
+    query.addBindValue(url);
+    query.addBindValue(attributes);
+    query.exec();
+}
+
 void Writer::insertDoc(const QString &namespaceName,
                        const QString &attributes,
                        const QString &url,
                        const QString &title,
-                       const QString &contents)
+                       const QString &contents,
+                       const QByteArray &hash)
 {
     m_namespaces.append(namespaceName);
     m_attributes.append(attributes);
     m_urls.append(url);
     m_titles.append(title);
     m_contents.append(contents);
+    m_hashes.append(hash);
 }
 
 void Writer::startTransaction()
@@ -238,6 +329,7 @@ void Writer::startTransaction()
         return;
 
     m_needOptimize = false;
+    m_needMerge = false;
     if (m_db && m_db->driver()->hasFeature(QSqlDriver::Transactions))
         m_db->transaction();
 }
@@ -249,9 +341,11 @@ void Writer::endTransaction()
 
     QSqlQuery query(*m_db);
 
-    if (m_needOptimize) {
-        query.exec(QLatin1String("INSERT INTO titles(titles) VALUES('rebuild')"));
-        query.exec(QLatin1String("INSERT INTO contents(contents) VALUES('rebuild')"));
+    // The triggers keep the FTS tables in sync with info, so merging
+    // the index segments left by the changes is enough.
+    if (m_needOptimize || m_needMerge) {
+        query.exec(QLatin1String("INSERT INTO titles(titles, rank) VALUES('merge', 500)"));
+        query.exec(QLatin1String("INSERT INTO contents(contents, rank) VALUES('merge', 500)"));
     }
 
     if (m_db && m_db->driver()->hasFeature(QSqlDriver::Transactions))
@@ -282,6 +376,12 @@ void QHelpSearchIndexWriter::cancelIndexing()
     m_cancel = true;
 }
 
+bool QHelpSearchIndexWriter::isCancelled()
+{
+    QMutexLocker lock(&m_mutex);
+    return m_cancel;
+}
+
 void QHelpSearchIndexWriter::updateIndex(const QString &collectionFile,
                                          const QString &indexFilesFolder,
                                          bool reindex)
@@ -327,6 +427,48 @@ static bool clearIndexMap(QHelpEngineCore *engine)
     return engine->removeCustomValue(QLatin1String(IndexedNamespacesKey));
 }
 
+struct IndexedDocument
+{
+    QString url;
+    QByteArray compressedData;
+    QByteArray hash;
+    QString title;
+    QString contents;
+    bool isValid = false;
+};
+
+// Uncompresses and converts a single document. Called concurrently
+// from the worker threads, so it must not touch any shared state.
+// Pages are converted by QHelpHtmlTextExtractor rather than QTextDocument,
+// which needs the GUI font machinery and builds a full document tree.
+static void extractDocumentText(IndexedDocument *document)
+{
+    const QByteArray data = qUncompress(document->compressedData);
+    document->compressedData = QByteArray();
+    if (data.isEmpty())
+        return;
+
+    const QString &fullFileName = document->url;
+    if (fullFileName.endsWith(QLatin1String(".txt"))) {
+        QTextStream s(data);
+        auto encoding = QStringDecoder::encodingForHtml(data);
+        if (encoding)
+            s.setEncoding(*encoding);
+
+        const QString &text = s.readAll();
+        if (text.isEmpty())
+            return;
+
+        document->title = fullFileName.mid(fullFileName.lastIndexOf(QLatin1Char('/')) + 1);
+        document->contents = text.toHtmlEscaped();
+    } else {
+        const QHelpHtmlTextExtractor extractor = QHelpHtmlTextExtractor::fromHtml(data);
+        document->title = extractor.title().toHtmlEscaped();
+        document->contents = extractor.text().toHtmlEscaped();
+    }
+    document->isValid = true;
+}
+
 void QHelpSearchIndexWriter::run()
 {
     QMutexLocker lock(&m_mutex);
@@ -356,15 +498,20 @@ void QHelpSearchIndexWriter::run()
 
     const QStringList &registeredDocs = engine.registeredDocumentations();
     QMap<QString, QDateTime> indexMap = readIndexMap(engine);
+    QSet<QString> updatedNamespaces;
 
     if (!reindex) {
         for (const QString &namespaceName : registeredDocs) {
             if (indexMap.contains(namespaceName)) {
                 const QString path = engine.documentationFileName(namespaceName);
                 if (indexMap.value(namespaceName) < QFileInfo(path).lastModified()) {
-                    // Remove some outdated indexed stuff
+                    // Update only the changed documents if we know
+                    // their hashes, otherwise remove the outdated stuff
                     indexMap.remove(namespaceName);
-                    writer.removeNamespace(namespaceName);
+                    if (writer.hasDocumentHashes(namespaceName))
+                        updatedNamespaces.insert(namespaceName);
+                    else
+                        writer.removeNamespace(namespaceName);
                 } else if (!writer.hasNamespace(namespaceName)) {
                     // No data in fts db for namespace.
                     // The namespace could have been removed from fts db
@@ -416,34 +563,33 @@ void QHelpSearchIndexWriter::run()
 
         const QString virtualFolder = reader.virtualFolder();
 
+        // For an updated namespace, the hashes of the documents indexed
+        // so far. Whatever is left in here at the end has been removed.
+        QHash<QString, QByteArray> oldHashes;
+        if (updatedNamespaces.contains(namespaceName))
+            oldHashes = writer.documentHashes(namespaceName);
+
         const QList<QStringList> &attributeSets =
             engine.filterAttributeSets(namespaceName);
 
         for (const QStringList &attributes : attributeSets) {
             const QString &attributesString = attributes.join(QLatin1Char('|'));
 
+            // The data is uncompressed by the workers rather than by the reader.
             const QMultiMap<QString, QByteArray> htmlFiles =
-                    reader.filesData(attributes, QLatin1String("html"));
+                    reader.filesData(attributes, QLatin1String("html"), false);
             const QMultiMap<QString, QByteArray> htmFiles =
-                    reader.filesData(attributes, QLatin1String("htm"));
+                    reader.filesData(attributes, QLatin1String("htm"), false);
             const QMultiMap<QString, QByteArray> txtFiles =
-                    reader.filesData(attributes, QLatin1String("txt"));
+                    reader.filesData(attributes, QLatin1String("txt"), false);
 
             QMultiMap<QString, QByteArray> files = htmlFiles;
             files.unite(htmFiles);
             files.unite(txtFiles);
 
+            std::vector<IndexedDocument> documents;
+            documents.reserve(files.size());
             for (auto it = files.cbegin(), end = files.cend(); it != end ; ++it) {
-                lock.relock();
-                if (m_cancel) {
-                    // store what we have done so far
-                    writeIndexMap(&engine, indexMap);
-                    writer.endTransaction();
-                    emit indexingFinished();
-                    return;
-                }
-                lock.unlock();
-
                 const QString &file = it.key();
                 const QByteArray &data = it.value();
 
@@ -465,31 +611,67 @@ void QHelpSearchIndexWriter::run()
                     continue;
                 }
 
-                QTextStream s(data);
-                auto encoding = QStringDecoder::encodingForHtml(data);
-                if (encoding)
-                    s.setEncoding(*encoding);
-
-                const QString &text = s.readAll();
-                if (text.isEmpty())
-                    continue;
+                const QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+                const auto oldHash = oldHashes.constFind(documentKey(attributesString, fullFileName));
+                if (oldHash != oldHashes.cend()) {
+                    const bool unchanged = oldHash.value() == hash;
+                    oldHashes.erase(oldHash);
+                    if (unchanged)
+                        continue;
+                    writer.removeDocument(attributesString, fullFileName);
+                }
 
-                QString title;
-                QString contents;
-                if (fullFileName.endsWith(QLatin1String(".txt"))) {
-                    title = fullFileName.mid(fullFileName.lastIndexOf(QLatin1Char('/')) + 1);
-                    contents = text.toHtmlEscaped();
-                } else {
-                    QTextDocument doc;
-                    doc.setHtml(text);
-
-                    title = doc.metaInformation(QTextDocument::DocumentTitle).toHtmlEscaped();
-                    contents = doc.toPlainText().toHtmlEscaped();
+                IndexedDocument document;
+                document.url = fullFileName;
+                document.compressedData = data;
+                document.hash = hash;
+                documents.push_back(std::move(document));
+            }
+            files.clear();
+
+            // Uncompress and convert the documents on all cores; this
+            // thread stays the only one writing to the database.
+            std::atomic<size_t> nextDocument(0);
+            std::atomic<bool> cancelled(false);
+            auto extractDocuments = [&]() {
+                for (size_t i = nextDocument++; i < documents.size(); i = nextDocument++) {
+                    if (cancelled || isCancelled()) {
+                        cancelled = true;
+                        return;
+                    }
+                    extractDocumentText(&documents[i]);
                 }
+            };
+
+            const size_t workerCount = std::min(documents.size(),
+                                                size_t(std::max(QThread::idealThreadCount(), 1)));
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < workerCount; ++i)
+                workers.emplace_back(extractDocuments);
+            extractDocuments();
+            for (std::thread &worker : workers)
+                worker.join();
+
+            if (cancelled) {
+                // store what we have done so far
+                writeIndexMap(&engine, indexMap);
+                writer.endTransaction();
+                emit indexingFinished();
+                return;
+            }
 
-                writer.insertDoc(namespaceName, attributesString, fullFileName, title, contents);
+            for (const IndexedDocument &document : documents) {
+                if (document.isValid) {
+                    writer.insertDoc(namespaceName, attributesString, document.url,
+                                     document.title, document.contents, document.hash);
+                }
             }
         }
+        for (auto it = oldHashes.cbegin(), end = oldHashes.cend(); it != end; ++it) {
+            const QString &key = it.key();
+            const qsizetype separator = key.indexOf(QLatin1Char('\n'));
+            writer.removeDocument(key.left(separator), key.mid(separator + 1));
+        }
         writer.flush();
         const QString &path = engine.documentationFileName(namespaceName);
         indexMap.insert(namespaceName, QFileInfo(path).lastModified());
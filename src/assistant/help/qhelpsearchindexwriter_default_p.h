@@ -15,6 +15,7 @@
 // We mean it.
 //
 
+#include <QtCore/QHash>
 #include <QtCore/QMutex>
 #include <QtCore/QThread>
 
@@ -36,11 +37,15 @@ public:
 
     void removeNamespace(const QString &namespaceName);
     bool hasNamespace(const QString &namespaceName);
+    bool hasDocumentHashes(const QString &namespaceName);
+    QHash<QString, QByteArray> documentHashes(const QString &namespaceName);
+    void removeDocument(const QString &attributes, const QString &url);
     void insertDoc(const QString &namespaceName,
                    const QString &attributes,
                    const QString &url,
                    const QString &title,
-                   const QString &contents);
+                   const QString &contents,
+                   const QByteArray &hash);
     void startTransaction();
     void endTransaction();
 private:
@@ -52,12 +57,14 @@ private:
     QString m_uniqueId;
 
     bool m_needOptimize = false;
+    bool m_needMerge = false;
     QSqlDatabase *m_db = nullptr;
     QVariantList m_namespaces;
     QVariantList m_attributes;
     QVariantList m_urls;
     QVariantList m_titles;
     QVariantList m_contents;
+    QVariantList m_hashes;
 };
 
 
@@ -79,6 +86,7 @@ signals:
 
 private:
     void run() override;
+    bool isCancelled();
 
 private:
     QMutex m_mutex;
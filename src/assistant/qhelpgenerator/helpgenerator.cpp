@@ -4,6 +4,7 @@
 #include "helpgenerator.h"
 #include "qhelpprojectdata_p.h"
 #include <qhelp_global.h>
+#include <QtHelp/private/qhelphtmltextextractor_p.h>
 
 #include <QtCore/QtMath>
 #include <QtCore/QMap>
@@ -18,8 +19,15 @@
 #include <QtCore/QDateTime>
 #include <QtCore/QStringConverter>
 #include <QtCore/QDataStream>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
 #include <QtSql/QSqlQuery>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <stdio.h>
 
 QT_BEGIN_NAMESPACE
@@ -42,13 +50,6 @@ Q_SIGNALS:
     void warning(const QString &msg);
 
 private:
-    struct FileNameTableData
-    {
-        QString name;
-        int fileId;
-        QString title;
-    };
-
     void writeTree(QDataStream &s, QHelpDataContentItem *item, int depth);
     bool createTables();
     bool insertFileNotFoundFile();
@@ -426,58 +427,43 @@ bool HelpGeneratorPrivate::insertFiles(const QStringList &files, const QString &
     if (m_query->next())
         tableFileId = m_query->value(0).toInt() + 1;
 
-    QString title;
-    QString charSet;
-    QList<QByteArray> fileDataList;
+    // Files that are not in the database yet are read, titled and
+    // compressed on worker threads. Only a bounded window of them is
+    // kept in memory, and they are written in the order of files.
+    struct FileJob
+    {
+        QString name;
+        QString path;
+        QString title;
+        QByteArray data;
+        bool readable = false;
+        bool done = false;
+    };
+    std::vector<FileJob> jobs;
+    QSet<QString> newFileNames;
     QMap<int, QSet<int> > tmpFileFilterMap;
-    QList<FileNameTableData> fileNameDataList;
 
-    int i = 0;
     for (const QString &file : files) {
         const QString fileName = QDir::cleanPath(file);
+        const QString filePath = rootPath + QDir::separator() + fileName;
 
-        QFile fi(rootPath + QDir::separator() + fileName);
-        if (!fi.exists()) {
+        if (!QFile::exists(filePath)) {
             emit warning(tr("The file %1 does not exist, skipping it...")
-                .arg(QDir::cleanPath(rootPath + QDir::separator() + fileName)));
+                .arg(QDir::cleanPath(filePath)));
             continue;
         }
 
-        if (!fi.open(QIODevice::ReadOnly)) {
-            emit warning(tr("Cannot open file %1, skipping it...")
-                .arg(QDir::cleanPath(rootPath + QDir::separator() + fileName)));
-            continue;
-        }
-
-        QByteArray data = fi.readAll();
-        if (fileName.endsWith(QLatin1String(".html"))
-            || fileName.endsWith(QLatin1String(".htm"))) {
-            auto encoding = QStringDecoder::encodingForHtml(data);
-            if (!encoding)
-                encoding = QStringDecoder::Utf8;
-            title = QHelpGlobal::documentTitle(QStringDecoder(*encoding)(data));
-        } else {
-            title = fileName.mid(fileName.lastIndexOf(QLatin1Char('/')) + 1);
-        }
-
-        int fileId = -1;
         const auto &it = m_fileMap.constFind(fileName);
         if (it == m_fileMap.cend()) {
-            fileDataList.append(qCompress(data));
-
-            FileNameTableData fileNameData;
-            fileNameData.name = fileName;
-            fileNameData.fileId = tableFileId;
-            fileNameData.title = title;
-            fileNameDataList.append(fileNameData);
-
-            m_fileMap.insert(fileName, tableFileId);
-            m_fileFilterMap.insert(tableFileId, filterAtts);
-            tmpFileFilterMap.insert(tableFileId, filterAtts);
-
-            ++tableFileId;
+            if (!newFileNames.contains(fileName)) {
+                newFileNames.insert(fileName);
+                FileJob job;
+                job.name = fileName;
+                job.path = filePath;
+                jobs.push_back(std::move(job));
+            }
         } else {
-            fileId = it.value();
+            const int fileId = it.value();
             QSet<int> &fileFilterSet = m_fileFilterMap[fileId];
             QSet<int> &tmpFileFilterSet = tmpFileFilterMap[fileId];
             for (int filter : qAsConst(filterAtts)) {
@@ -490,41 +476,117 @@ bool HelpGeneratorPrivate::insertFiles(const QStringList &files, const QString &
         }
     }
 
-    if (!tmpFileFilterMap.isEmpty()) {
-        m_query->exec(QLatin1String("BEGIN"));
-        for (auto it = tmpFileFilterMap.cbegin(), end = tmpFileFilterMap.cend(); it != end; ++it) {
-            QList<int> filterValues = it.value().values();
-            std::sort(filterValues.begin(), filterValues.end());
-            for (int fv : qAsConst(filterValues)) {
-                m_query->prepare(QLatin1String("INSERT INTO FileFilterTable "
-                    "VALUES(?, ?)"));
-                m_query->bindValue(0, fv);
-                m_query->bindValue(1, it.key());
-                m_query->exec();
+    QMutex mutex;
+    QWaitCondition jobDone;
+    QWaitCondition jobConsumed;
+    size_t nextJob = 0;
+    size_t consumedJobs = 0;
+    const size_t workerCount = std::min(jobs.size(),
+                                        size_t(std::max(QThread::idealThreadCount(), 1)));
+    const size_t window = workerCount * 16;
+
+    auto processJobs = [&]() {
+        QMutexLocker locker(&mutex);
+        while (nextJob < jobs.size()) {
+            const size_t index = nextJob++;
+            while (index >= consumedJobs + window)
+                jobConsumed.wait(&mutex);
+            FileJob &job = jobs[index];
+            locker.unlock();
+
+            QFile fi(job.path);
+            if (fi.open(QIODevice::ReadOnly)) {
+                const QByteArray data = fi.readAll();
+                if (job.name.endsWith(QLatin1String(".html"))
+                    || job.name.endsWith(QLatin1String(".htm"))) {
+                    job.title = QHelpHtmlTextExtractor::fromHtml(
+                                data, QHelpHtmlTextExtractor::TitleOnly).documentTitle();
+                } else {
+                    job.title = job.name.mid(job.name.lastIndexOf(QLatin1Char('/')) + 1);
+                }
+                job.data = qCompress(data);
+                job.readable = true;
             }
+
+            locker.relock();
+            job.done = true;
+            jobDone.wakeAll();
         }
+    };
 
-        for (const QByteArray &fileData : qAsConst(fileDataList)) {
-            m_query->prepare(QLatin1String("INSERT INTO FileDataTable VALUES "
-                "(Null, ?)"));
-            m_query->bindValue(0, fileData);
-            m_query->exec();
-            if (++i % 20 == 0)
-                addProgress(m_fileStep * 20.0);
+    std::vector<std::thread> workers;
+    for (size_t n = 0; n < workerCount; ++n)
+        workers.emplace_back(processJobs);
+
+    const QSqlDatabase db = QSqlDatabase::database(QLatin1String("builder"));
+    QSqlQuery dataQuery(db);
+    dataQuery.prepare(QLatin1String("INSERT INTO FileDataTable VALUES (Null, ?)"));
+    QSqlQuery nameQuery(db);
+    nameQuery.prepare(QLatin1String("INSERT INTO FileNameTable "
+        "(FolderId, Name, FileId, Title) VALUES (?, ?, ?, ?)"));
+    QSqlQuery filterQuery(db);
+    filterQuery.prepare(QLatin1String("INSERT INTO FileFilterTable VALUES(?, ?)"));
+
+    m_query->exec(QLatin1String("BEGIN"));
+    int i = 0;
+    for (size_t index = 0; index < jobs.size(); ++index) {
+        FileJob job;
+        {
+            QMutexLocker locker(&mutex);
+            while (!jobs[index].done)
+                jobDone.wait(&mutex);
+            job = std::move(jobs[index]);
+            ++consumedJobs;
+            jobConsumed.wakeAll();
         }
 
-        for (const FileNameTableData &fnd : qAsConst(fileNameDataList)) {
-            m_query->prepare(QLatin1String("INSERT INTO FileNameTable "
-                "(FolderId, Name, FileId, Title) VALUES (?, ?, ?, ?)"));
-            m_query->bindValue(0, 1);
-            m_query->bindValue(1, fnd.name);
-            m_query->bindValue(2, fnd.fileId);
-            m_query->bindValue(3, fnd.title);
-            m_query->exec();
+        if (!job.readable) {
+            emit warning(tr("Cannot open file %1, skipping it...")
+                .arg(QDir::cleanPath(job.path)));
+            continue;
+        }
+
+        dataQuery.bindValue(0, job.data);
+        dataQuery.exec();
+
+        nameQuery.bindValue(0, 1);
+        nameQuery.bindValue(1, job.name);
+        nameQuery.bindValue(2, tableFileId);
+        nameQuery.bindValue(3, job.title);
+        nameQuery.exec();
+
+        for (int attId : qAsConst(attValues)) {
+            filterQuery.bindValue(0, attId);
+            filterQuery.bindValue(1, tableFileId);
+            filterQuery.exec();
+        }
+
+        m_fileMap.insert(job.name, tableFileId);
+        m_fileFilterMap.insert(tableFileId, filterAtts);
+        ++tableFileId;
+
+        if (++i % 20 == 0)
+            addProgress(m_fileStep * 20.0);
+        if (i % 1000 == 0) {
+            m_query->exec(QLatin1String("COMMIT"));
+            m_query->exec(QLatin1String("BEGIN"));
         }
-        m_query->exec(QLatin1String("COMMIT"));
     }
 
+    for (std::thread &worker : workers)
+        worker.join();
+
+    for (auto it = tmpFileFilterMap.cbegin(), end = tmpFileFilterMap.cend(); it != end; ++it) {
+        QList<int> filterValues = it.value().values();
+        std::sort(filterValues.begin(), filterValues.end());
+        for (int fv : qAsConst(filterValues)) {
+            filterQuery.bindValue(0, fv);
+            filterQuery.bindValue(1, it.key());
+            filterQuery.exec();
+        }
+    }
+    m_query->exec(QLatin1String("COMMIT"));
+
     m_query->exec(QLatin1String("SELECT MAX(Id) FROM FileDataTable"));
     if (m_query->next()
             && m_query->value(0).toInt() == tableFileId - 1) {
@@ -322,7 +322,9 @@
         <xsl:text>();&endl;&endl;</xsl:text>
 
         <xsl:text>    void read(QXmlStreamReader &amp;reader);&endl;</xsl:text>
-        <xsl:text>    void write(QXmlStreamWriter &amp;writer, const QString &amp;tagName = QString()) const;&endl;&endl;</xsl:text>
+        <xsl:text>    void write(QXmlStreamWriter &amp;writer, const QString &amp;tagName = QString()) const;&endl;</xsl:text>
+        <xsl:text>    void read(QUiBinaryReader &amp;reader);&endl;</xsl:text>
+        <xsl:text>    void write(QUiBinaryWriter &amp;writer) const;&endl;&endl;</xsl:text>
 
         <xsl:if test="$hasText">
             <xsl:text>    inline QString text() const { return m_text; }&endl;</xsl:text>
@@ -397,6 +399,36 @@
         <xsl:text>};&endl;&endl;</xsl:text>
     </xsl:template>
 
+<!-- Schema signature -->
+
+    <xsl:template name="schema-signature">
+        <xsl:param name="node"/>
+        <xsl:text>    "</xsl:text>
+        <xsl:value-of select="$node/@name"/>
+        <xsl:if test="$node[@mixed='true']">
+            <xsl:text>~</xsl:text>
+        </xsl:if>
+        <xsl:text>{</xsl:text>
+        <xsl:for-each select="$node/xs:attribute | $node//xs:element">
+            <xsl:if test="position() != 1">
+                <xsl:text>,</xsl:text>
+            </xsl:if>
+            <xsl:if test="self::xs:attribute">
+                <xsl:text>@</xsl:text>
+            </xsl:if>
+            <xsl:value-of select="@name"/>
+            <xsl:text>:</xsl:text>
+            <xsl:value-of select="@type"/>
+            <xsl:if test="@maxOccurs = 'unbounded'">
+                <xsl:text>*</xsl:text>
+            </xsl:if>
+            <xsl:if test="@use = 'deprecated'">
+                <xsl:text>-</xsl:text>
+            </xsl:if>
+        </xsl:for-each>
+        <xsl:text>}"&endl;</xsl:text>
+    </xsl:template>
+
 <!-- Root -->
 
     <xsl:template match="xs:schema">
@@ -458,6 +490,25 @@ namespace QFormInternal
                 <xsl:with-param name="node" select="."/>
             </xsl:call-template>
         </xsl:for-each>
+        <xsl:text>&endl;</xsl:text>
+        <xsl:text>class QUiBinaryReader;&endl;</xsl:text>
+        <xsl:text>class QUiBinaryWriter;&endl;</xsl:text>
+
+        <xsl:text>&endl;</xsl:text>
+        <xsl:text>/*******************************************************************************&endl;</xsl:text>
+        <xsl:text>** Schema signature&endl;</xsl:text>
+        <xsl:text>*/&endl;&endl;</xsl:text>
+
+        <xsl:text>// The attributes and child elements of every type of the schema. The binary&endl;</xsl:text>
+        <xsl:text>// form format stores a hash of it to reject files written for another&endl;</xsl:text>
+        <xsl:text>// version of the schema.&endl;</xsl:text>
+        <xsl:text>inline constexpr char ui4SchemaSignature[] =&endl;</xsl:text>
+        <xsl:for-each select="xs:complexType">
+            <xsl:call-template name="schema-signature">
+                <xsl:with-param name="node" select="."/>
+            </xsl:call-template>
+        </xsl:for-each>
+        <xsl:text>    ;&endl;</xsl:text>
 
         <xsl:text>&endl;</xsl:text>
         <xsl:text>/*******************************************************************************&endl;</xsl:text>
@@ -169,6 +169,147 @@
         <xsl:text>"_s</xsl:text>
     </xsl:template>
 
+<!-- Implementation: element and attribute name tokens
+
+     The readers switch on tokens for element and attribute names. The lookup
+     functions switch on the length and the first character of a name, so
+     a name is compared against at most a few candidates. Element names are
+     matched case-insensitively, attribute names case-sensitively. -->
+
+    <xsl:key name="element-by-name" match="xs:sequence/xs:element | xs:choice/xs:element | xs:all/xs:element"
+             use="translate(@name, 'ABCDEFGHIJKLMNOPQRSTUVWXYZ', 'abcdefghijklmnopqrstuvwxyz')"/>
+    <xsl:key name="element-by-length" match="xs:sequence/xs:element | xs:choice/xs:element | xs:all/xs:element"
+             use="string-length(@name)"/>
+    <xsl:key name="element-by-first-char" match="xs:sequence/xs:element | xs:choice/xs:element | xs:all/xs:element"
+             use="concat(string-length(@name), translate(substring(@name, 1, 1), 'ABCDEFGHIJKLMNOPQRSTUVWXYZ', 'abcdefghijklmnopqrstuvwxyz'))"/>
+
+    <xsl:key name="attribute-by-name" match="xs:complexType/xs:attribute"
+             use="@name"/>
+    <xsl:key name="attribute-by-length" match="xs:complexType/xs:attribute"
+             use="string-length(@name)"/>
+    <xsl:key name="attribute-by-first-char" match="xs:complexType/xs:attribute"
+             use="concat(string-length(@name), substring(@name, 1, 1))"/>
+
+    <xsl:template name="name-token-enumerator">
+        <xsl:param name="name"/>
+        <xsl:call-template name="cap-first-char">
+            <xsl:with-param name="text" select="$name"/>
+        </xsl:call-template>
+    </xsl:template>
+
+    <xsl:template name="name-token-lookup">
+        <xsl:param name="kind"/>
+        <xsl:param name="nodes"/>
+        <xsl:param name="case-insensitive"/>
+        <xsl:variable name="from">
+            <xsl:if test="$case-insensitive">ABCDEFGHIJKLMNOPQRSTUVWXYZ</xsl:if>
+        </xsl:variable>
+        <xsl:variable name="to">
+            <xsl:if test="$case-insensitive">abcdefghijklmnopqrstuvwxyz</xsl:if>
+        </xsl:variable>
+        <xsl:variable name="cap-kind">
+            <xsl:call-template name="cap-first-char">
+                <xsl:with-param name="text" select="$kind"/>
+            </xsl:call-template>
+        </xsl:variable>
+        <xsl:variable name="type" select="concat('Ui', $cap-kind)"/>
+        <xsl:variable name="distinct"
+                      select="$nodes[generate-id() = generate-id(key(concat($kind, '-by-name'), translate(@name, $from, $to))[1])]"/>
+
+        <xsl:text>enum class </xsl:text>
+        <xsl:value-of select="$type"/>
+        <xsl:text> {&endl;</xsl:text>
+        <xsl:text>    Unknown</xsl:text>
+        <xsl:for-each select="$distinct">
+            <xsl:sort select="translate(@name, $from, $to)"/>
+            <xsl:text>,&endl;    </xsl:text>
+            <xsl:call-template name="name-token-enumerator">
+                <xsl:with-param name="name" select="translate(@name, $from, $to)"/>
+            </xsl:call-template>
+        </xsl:for-each>
+        <xsl:text>&endl;};&endl;&endl;</xsl:text>
+
+        <xsl:value-of select="$type"/>
+        <xsl:text> ui</xsl:text>
+        <xsl:value-of select="$cap-kind"/>
+        <xsl:text>(QStringView name)&endl;</xsl:text>
+        <xsl:text>{&endl;</xsl:text>
+        <xsl:text>    switch (name.size()) {&endl;</xsl:text>
+        <xsl:for-each select="$distinct[generate-id() = generate-id(key(concat($kind, '-by-length'), string-length(@name))[1])]">
+            <xsl:sort select="string-length(@name)" data-type="number"/>
+            <xsl:variable name="length" select="string-length(@name)"/>
+            <xsl:text>    case </xsl:text>
+            <xsl:value-of select="$length"/>
+            <xsl:text>:&endl;</xsl:text>
+            <xsl:choose>
+                <xsl:when test="$case-insensitive">
+                    <xsl:text>        switch (name.front().toCaseFolded().unicode()) {&endl;</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:text>        switch (name.front().unicode()) {&endl;</xsl:text>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:for-each select="key(concat($kind, '-by-length'), $length)[generate-id() = generate-id(key(concat($kind, '-by-first-char'), concat($length, translate(substring(@name, 1, 1), $from, $to)))[1])]">
+                <xsl:sort select="translate(substring(@name, 1, 1), $from, $to)"/>
+                <xsl:variable name="first-char" select="translate(substring(@name, 1, 1), $from, $to)"/>
+                <xsl:text>        case u'</xsl:text>
+                <xsl:value-of select="$first-char"/>
+                <xsl:text>':&endl;</xsl:text>
+                <xsl:for-each select="key(concat($kind, '-by-first-char'), concat($length, $first-char))[generate-id() = generate-id(key(concat($kind, '-by-name'), translate(@name, $from, $to))[1])]">
+                    <xsl:sort select="translate(@name, $from, $to)"/>
+                    <xsl:variable name="name" select="translate(@name, $from, $to)"/>
+                    <xsl:choose>
+                        <xsl:when test="$case-insensitive">
+                            <xsl:text>            if (!name.compare(</xsl:text>
+                            <xsl:call-template name="string-constant">
+                                <xsl:with-param name="literal" select="$name"/>
+                            </xsl:call-template>
+                            <xsl:text>, Qt::CaseInsensitive))&endl;</xsl:text>
+                        </xsl:when>
+                        <xsl:otherwise>
+                            <xsl:text>            if (name == </xsl:text>
+                            <xsl:call-template name="string-constant">
+                                <xsl:with-param name="literal" select="$name"/>
+                            </xsl:call-template>
+                            <xsl:text>)&endl;</xsl:text>
+                        </xsl:otherwise>
+                    </xsl:choose>
+                    <xsl:text>                return </xsl:text>
+                    <xsl:value-of select="$type"/>
+                    <xsl:text>::</xsl:text>
+                    <xsl:call-template name="name-token-enumerator">
+                        <xsl:with-param name="name" select="$name"/>
+                    </xsl:call-template>
+                    <xsl:text>;&endl;</xsl:text>
+                </xsl:for-each>
+                <xsl:text>            break;&endl;</xsl:text>
+            </xsl:for-each>
+            <xsl:text>        }&endl;</xsl:text>
+            <xsl:text>        break;&endl;</xsl:text>
+        </xsl:for-each>
+        <xsl:text>    }&endl;</xsl:text>
+        <xsl:text>    return </xsl:text>
+        <xsl:value-of select="$type"/>
+        <xsl:text>::Unknown;&endl;</xsl:text>
+        <xsl:text>}&endl;&endl;</xsl:text>
+    </xsl:template>
+
+    <xsl:template name="name-tokens">
+        <xsl:param name="node"/>
+        <xsl:text>namespace {&endl;&endl;</xsl:text>
+        <xsl:call-template name="name-token-lookup">
+            <xsl:with-param name="kind" select="'element'"/>
+            <xsl:with-param name="nodes" select="$node/xs:complexType//xs:sequence/xs:element | $node/xs:complexType//xs:choice/xs:element | $node/xs:complexType//xs:all/xs:element"/>
+            <xsl:with-param name="case-insensitive" select="true()"/>
+        </xsl:call-template>
+        <xsl:call-template name="name-token-lookup">
+            <xsl:with-param name="kind" select="'attribute'"/>
+            <xsl:with-param name="nodes" select="$node/xs:complexType/xs:attribute"/>
+            <xsl:with-param name="case-insensitive" select="false()"/>
+        </xsl:call-template>
+        <xsl:text>} // namespace&endl;&endl;</xsl:text>
+    </xsl:template>
+
 <!-- Implementation: read(QXmlStreamReader) -->
 
     <xsl:template name="read-impl-load-attributes">
@@ -178,6 +319,7 @@
             <xsl:text>    const QXmlStreamAttributes &amp;attributes = reader.attributes();&endl;</xsl:text>
             <xsl:text>    for (const QXmlStreamAttribute &amp;attribute : attributes) {&endl;</xsl:text>
             <xsl:text>        const auto name = attribute.name();&endl;</xsl:text>
+            <xsl:text>        switch (uiAttribute(name)) {&endl;</xsl:text>
 
             <xsl:for-each select="$node/xs:attribute">
                 <xsl:variable name="camel-case-name">
@@ -199,19 +341,21 @@
                     </xsl:call-template>
                 </xsl:variable>
 
-                <xsl:text>        if (name == </xsl:text>
-                <xsl:call-template name="string-constant">
-                    <xsl:with-param name="literal" select="@name"/>
+                <xsl:text>        case UiAttribute::</xsl:text>
+                <xsl:call-template name="name-token-enumerator">
+                    <xsl:with-param name="name" select="@name"/>
                 </xsl:call-template>
-                <xsl:text>) {&endl;</xsl:text>
+                <xsl:text>:&endl;</xsl:text>
                 <xsl:text>            setAttribute</xsl:text>
                 <xsl:value-of select="$cap-name"/>
                 <xsl:text>(</xsl:text>
                 <xsl:value-of select="$qstring-func"/>
                 <xsl:text>);&endl;</xsl:text>
                 <xsl:text>            continue;&endl;</xsl:text>
-                <xsl:text>        }&endl;</xsl:text>
             </xsl:for-each>
+            <xsl:text>        default:&endl;</xsl:text>
+            <xsl:text>            break;&endl;</xsl:text>
+            <xsl:text>        }&endl;</xsl:text>
 
             <xsl:text>        reader.raiseError("Unexpected attribute "_L1 + name);&endl;</xsl:text>
             <xsl:text>    }&endl;</xsl:text>
@@ -246,11 +390,17 @@
             </xsl:variable>
             <xsl:variable name="array" select="@maxOccurs = 'unbounded'"/>
 
-            <xsl:text>            if (!tag.compare(</xsl:text>
-            <xsl:call-template name="string-constant">
-                <xsl:with-param name="literal" select="$lower-name"/>
+            <xsl:variable name="scoped" select="$xs-type-cat = 'pointer' and not(@use = 'deprecated')"/>
+
+            <xsl:text>            case UiElement::</xsl:text>
+            <xsl:call-template name="name-token-enumerator">
+                <xsl:with-param name="name" select="$lower-name"/>
             </xsl:call-template>
-            <xsl:text>, Qt::CaseInsensitive)) {&endl;</xsl:text>
+            <xsl:text>:</xsl:text>
+            <xsl:if test="$scoped">
+                <xsl:text> {</xsl:text>
+            </xsl:if>
+            <xsl:text>&endl;</xsl:text>
 
             <xsl:choose>
                 <xsl:when test="@use='deprecated'">
@@ -309,7 +459,9 @@
                 </xsl:when>
             </xsl:choose>
             <xsl:text>                continue;&endl;</xsl:text>
-            <xsl:text>            }&endl;</xsl:text>
+            <xsl:if test="$scoped">
+                <xsl:text>            }&endl;</xsl:text>
+            </xsl:if>
         </xsl:for-each>
     </xsl:template>
 
@@ -332,11 +484,18 @@
         <xsl:text>        case QXmlStreamReader::StartElement : {&endl;</xsl:text>
         <xsl:text>            const auto tag = reader.name();&endl;</xsl:text>
 
-        <xsl:for-each select="$node//xs:sequence | $node//xs:choice | $node//xs:all">
-            <xsl:call-template name="read-impl-load-child-element">
-                <xsl:with-param name="node" select="."/>
-            </xsl:call-template>
-        </xsl:for-each>
+        <xsl:variable name="groups" select="$node//xs:sequence | $node//xs:choice | $node//xs:all"/>
+        <xsl:if test="$groups/xs:element">
+            <xsl:text>            switch (uiElement(tag)) {&endl;</xsl:text>
+            <xsl:for-each select="$groups">
+                <xsl:call-template name="read-impl-load-child-element">
+                    <xsl:with-param name="node" select="."/>
+                </xsl:call-template>
+            </xsl:for-each>
+            <xsl:text>            default:&endl;</xsl:text>
+            <xsl:text>                break;&endl;</xsl:text>
+            <xsl:text>            }&endl;</xsl:text>
+        </xsl:if>
 
         <xsl:text>            reader.raiseError("Unexpected element "_L1 + tag);&endl;</xsl:text>
         <xsl:text>        }&endl;</xsl:text>
@@ -620,6 +779,404 @@
         <xsl:text>}&endl;&endl;</xsl:text>
     </xsl:template>
 
+<!-- Implementation: read(QUiBinaryReader)
+
+     The binary form format (see uibinaryformat_p.h) writes a bit mask of the
+     attributes present followed by their values, then a bit mask of the child
+     elements of each sequence followed by their values, or the kind of
+     a choice followed by its value, then the text. Deprecated elements are
+     not stored. -->
+
+    <xsl:template name="binary-read-impl-load-attributes">
+        <xsl:param name="node"/>
+
+        <xsl:if test="$node/xs:attribute">
+            <xsl:text>    const quint32 attributes = reader.readMask();&endl;</xsl:text>
+            <xsl:for-each select="$node/xs:attribute">
+                <xsl:variable name="camel-case-name">
+                    <xsl:call-template name="camel-case">
+                        <xsl:with-param name="text" select="@name"/>
+                    </xsl:call-template>
+                </xsl:variable>
+                <xsl:variable name="cap-name">
+                    <xsl:call-template name="cap-first-char">
+                        <xsl:with-param name="text" select="$camel-case-name"/>
+                    </xsl:call-template>
+                </xsl:variable>
+                <xsl:variable name="cpp-type">
+                    <xsl:call-template name="xs-type-to-cpp-type">
+                        <xsl:with-param name="xs-type" select="@type"/>
+                    </xsl:call-template>
+                </xsl:variable>
+
+                <xsl:text>    if (attributes &amp; (1u &lt;&lt; </xsl:text>
+                <xsl:value-of select="position() - 1"/>
+                <xsl:text>))&endl;</xsl:text>
+                <xsl:text>        setAttribute</xsl:text>
+                <xsl:value-of select="$cap-name"/>
+                <xsl:text>(reader.readValue&lt;</xsl:text>
+                <xsl:value-of select="$cpp-type"/>
+                <xsl:text>&gt;());&endl;</xsl:text>
+            </xsl:for-each>
+        </xsl:if>
+    </xsl:template>
+
+    <!-- The statement reading the value of a child element -->
+    <xsl:template name="binary-read-child-element-value">
+        <xsl:param name="indent"/>
+        <xsl:variable name="array" select="@maxOccurs = 'unbounded'"/>
+        <xsl:variable name="camel-case-name">
+            <xsl:call-template name="camel-case">
+                <xsl:with-param name="text" select="@name"/>
+            </xsl:call-template>
+        </xsl:variable>
+        <xsl:variable name="cap-name">
+            <xsl:call-template name="cap-first-char">
+                <xsl:with-param name="text" select="$camel-case-name"/>
+            </xsl:call-template>
+        </xsl:variable>
+        <xsl:variable name="xs-type-cat">
+            <xsl:call-template name="xs-type-category">
+                <xsl:with-param name="xs-type" select="@type"/>
+            </xsl:call-template>
+        </xsl:variable>
+        <xsl:variable name="cpp-type">
+            <xsl:call-template name="xs-type-to-cpp-type">
+                <xsl:with-param name="xs-type" select="@type"/>
+                <xsl:with-param name="array" select="$array"/>
+            </xsl:call-template>
+        </xsl:variable>
+
+        <xsl:value-of select="$indent"/>
+        <xsl:text>setElement</xsl:text>
+        <xsl:value-of select="$cap-name"/>
+        <xsl:text>(reader.</xsl:text>
+        <xsl:choose>
+            <xsl:when test="$xs-type-cat = 'value'">
+                <xsl:text>readValue&lt;</xsl:text>
+                <xsl:value-of select="$cpp-type"/>
+                <xsl:text>&gt;</xsl:text>
+            </xsl:when>
+            <xsl:when test="$array">
+                <xsl:text>readList&lt;Dom</xsl:text>
+                <xsl:value-of select="@type"/>
+                <xsl:text>&gt;</xsl:text>
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:text>readNode&lt;Dom</xsl:text>
+                <xsl:value-of select="@type"/>
+                <xsl:text>&gt;</xsl:text>
+            </xsl:otherwise>
+        </xsl:choose>
+        <xsl:text>());&endl;</xsl:text>
+    </xsl:template>
+
+    <xsl:template name="binary-read-impl-load-choice-child-element">
+        <xsl:param name="node"/>
+
+        <xsl:text>    switch (reader.readValue&lt;quint8&gt;()) {&endl;</xsl:text>
+        <xsl:text>    case Unknown:&endl;</xsl:text>
+        <xsl:text>        break;&endl;</xsl:text>
+        <xsl:for-each select="$node/xs:element[not(@use) or (@use!='deprecated')]">
+            <xsl:variable name="camel-case-name">
+                <xsl:call-template name="camel-case">
+                    <xsl:with-param name="text" select="@name"/>
+                </xsl:call-template>
+            </xsl:variable>
+
+            <xsl:text>    case </xsl:text>
+            <xsl:call-template name="cap-first-char">
+                <xsl:with-param name="text" select="$camel-case-name"/>
+            </xsl:call-template>
+            <xsl:text>:&endl;</xsl:text>
+            <xsl:call-template name="binary-read-child-element-value">
+                <xsl:with-param name="indent" select="'        '"/>
+            </xsl:call-template>
+            <xsl:text>        break;&endl;</xsl:text>
+        </xsl:for-each>
+        <xsl:text>    default:&endl;</xsl:text>
+        <xsl:text>        reader.raiseError();&endl;</xsl:text>
+        <xsl:text>        break;&endl;</xsl:text>
+        <xsl:text>    }&endl;</xsl:text>
+    </xsl:template>
+
+    <xsl:template name="binary-read-impl-load-sequence-child-element">
+        <xsl:param name="node"/>
+
+        <xsl:text>    const quint32 children = reader.readMask();&endl;</xsl:text>
+        <xsl:for-each select="$node/xs:element[not(@use) or (@use!='deprecated')]">
+            <xsl:text>    if (children &amp; (1u &lt;&lt; </xsl:text>
+            <xsl:value-of select="position() - 1"/>
+            <xsl:text>))&endl;</xsl:text>
+            <xsl:call-template name="binary-read-child-element-value">
+                <xsl:with-param name="indent" select="'        '"/>
+            </xsl:call-template>
+        </xsl:for-each>
+    </xsl:template>
+
+    <xsl:template name="binary-read-impl">
+        <xsl:param name="node"/>
+        <xsl:variable name="name" select="concat('Dom', $node/@name)"/>
+        <xsl:variable name="groups" select="$node/xs:sequence[xs:element] | $node/xs:choice | $node/xs:all[xs:element]"/>
+
+        <xsl:text>void </xsl:text>
+        <xsl:value-of select="$name"/>
+        <xsl:text>::read(QUiBinaryReader &amp;reader)&endl;</xsl:text>
+        <xsl:text>{&endl;</xsl:text>
+
+        <xsl:call-template name="binary-read-impl-load-attributes">
+            <xsl:with-param name="node" select="$node"/>
+        </xsl:call-template>
+
+        <xsl:for-each select="$groups">
+            <xsl:choose>
+                <xsl:when test="self::xs:choice">
+                    <xsl:call-template name="binary-read-impl-load-choice-child-element">
+                        <xsl:with-param name="node" select="."/>
+                    </xsl:call-template>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:call-template name="binary-read-impl-load-sequence-child-element">
+                        <xsl:with-param name="node" select="."/>
+                    </xsl:call-template>
+                </xsl:otherwise>
+            </xsl:choose>
+        </xsl:for-each>
+
+        <xsl:if test="$node[@mixed='true']">
+            <xsl:text>    m_text = reader.readValue&lt;QString&gt;();&endl;</xsl:text>
+        </xsl:if>
+
+        <xsl:if test="not($node/xs:attribute) and not($groups) and not($node[@mixed='true'])">
+            <xsl:text>    Q_UNUSED(reader);&endl;</xsl:text>
+        </xsl:if>
+
+        <xsl:text>}&endl;&endl;</xsl:text>
+    </xsl:template>
+
+<!-- Implementation: write(QUiBinaryWriter) -->
+
+    <xsl:template name="binary-write-impl-save-attributes">
+        <xsl:param name="node"/>
+
+        <xsl:if test="$node/xs:attribute">
+            <xsl:text>    writer.writeMask({</xsl:text>
+            <xsl:for-each select="$node/xs:attribute">
+                <xsl:variable name="camel-case-name">
+                    <xsl:call-template name="camel-case">
+                        <xsl:with-param name="text" select="@name"/>
+                    </xsl:call-template>
+                </xsl:variable>
+                <xsl:if test="position() != 1">
+                    <xsl:text>,&endl;                      </xsl:text>
+                </xsl:if>
+                <xsl:text>m_has_attr_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+            </xsl:for-each>
+            <xsl:text>});&endl;</xsl:text>
+
+            <xsl:for-each select="$node/xs:attribute">
+                <xsl:variable name="camel-case-name">
+                    <xsl:call-template name="camel-case">
+                        <xsl:with-param name="text" select="@name"/>
+                    </xsl:call-template>
+                </xsl:variable>
+                <xsl:text>    if (m_has_attr_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+                <xsl:text>)&endl;</xsl:text>
+                <xsl:text>        writer.writeValue(m_attr_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+                <xsl:text>);&endl;</xsl:text>
+            </xsl:for-each>
+        </xsl:if>
+    </xsl:template>
+
+    <!-- The statement writing the value of a child element -->
+    <xsl:template name="binary-write-child-element-value">
+        <xsl:param name="indent"/>
+        <xsl:variable name="camel-case-name">
+            <xsl:call-template name="camel-case">
+                <xsl:with-param name="text" select="@name"/>
+            </xsl:call-template>
+        </xsl:variable>
+        <xsl:variable name="xs-type-cat">
+            <xsl:call-template name="xs-type-category">
+                <xsl:with-param name="xs-type" select="@type"/>
+            </xsl:call-template>
+        </xsl:variable>
+
+        <xsl:value-of select="$indent"/>
+        <xsl:choose>
+            <xsl:when test="$xs-type-cat = 'value'">
+                <xsl:text>writer.writeValue(m_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+                <xsl:text>);&endl;</xsl:text>
+            </xsl:when>
+            <xsl:when test="@maxOccurs = 'unbounded'">
+                <xsl:text>writer.writeList(m_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+                <xsl:text>);&endl;</xsl:text>
+            </xsl:when>
+            <xsl:otherwise>
+                <xsl:text>m_</xsl:text>
+                <xsl:value-of select="$camel-case-name"/>
+                <xsl:text>->write(writer);&endl;</xsl:text>
+            </xsl:otherwise>
+        </xsl:choose>
+    </xsl:template>
+
+    <xsl:template name="binary-write-impl-save-choice-child-element">
+        <xsl:param name="node"/>
+
+        <xsl:text>    switch (m_kind) {&endl;</xsl:text>
+        <xsl:for-each select="$node/xs:element[not(@use) or (@use!='deprecated')]">
+            <xsl:variable name="camel-case-name">
+                <xsl:call-template name="camel-case">
+                    <xsl:with-param name="text" select="@name"/>
+                </xsl:call-template>
+            </xsl:variable>
+            <xsl:variable name="cap-name">
+                <xsl:call-template name="cap-first-char">
+                    <xsl:with-param name="text" select="$camel-case-name"/>
+                </xsl:call-template>
+            </xsl:variable>
+            <xsl:variable name="xs-type-cat">
+                <xsl:call-template name="xs-type-category">
+                    <xsl:with-param name="xs-type" select="@type"/>
+                </xsl:call-template>
+            </xsl:variable>
+
+            <xsl:text>    case </xsl:text>
+            <xsl:value-of select="$cap-name"/>
+            <xsl:text>:&endl;</xsl:text>
+            <xsl:choose>
+                <xsl:when test="$xs-type-cat = 'value'">
+                    <xsl:text>        writer.writeValue(quint8(</xsl:text>
+                    <xsl:value-of select="$cap-name"/>
+                    <xsl:text>));&endl;</xsl:text>
+                    <xsl:call-template name="binary-write-child-element-value">
+                        <xsl:with-param name="indent" select="'        '"/>
+                    </xsl:call-template>
+                </xsl:when>
+                <xsl:otherwise>
+                    <!-- Like write(QXmlStreamWriter), omit a null value -->
+                    <xsl:text>        writer.writeValue(quint8(m_</xsl:text>
+                    <xsl:value-of select="$camel-case-name"/>
+                    <xsl:text> != nullptr ? </xsl:text>
+                    <xsl:value-of select="$cap-name"/>
+                    <xsl:text> : Unknown));&endl;</xsl:text>
+                    <xsl:text>        if (m_</xsl:text>
+                    <xsl:value-of select="$camel-case-name"/>
+                    <xsl:text> != nullptr)&endl;</xsl:text>
+                    <xsl:call-template name="binary-write-child-element-value">
+                        <xsl:with-param name="indent" select="'            '"/>
+                    </xsl:call-template>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:text>        break;&endl;</xsl:text>
+        </xsl:for-each>
+        <xsl:text>    default:&endl;</xsl:text>
+        <xsl:text>        writer.writeValue(quint8(Unknown));&endl;</xsl:text>
+        <xsl:text>        break;&endl;</xsl:text>
+        <xsl:text>    }&endl;</xsl:text>
+    </xsl:template>
+
+    <xsl:template name="binary-write-impl-save-sequence-child-element">
+        <xsl:param name="node"/>
+
+        <xsl:text>    writer.writeMask({</xsl:text>
+        <xsl:for-each select="$node/xs:element[not(@use) or (@use!='deprecated')]">
+            <xsl:variable name="camel-case-name">
+                <xsl:call-template name="camel-case">
+                    <xsl:with-param name="text" select="@name"/>
+                </xsl:call-template>
+            </xsl:variable>
+            <xsl:if test="position() != 1">
+                <xsl:text>,&endl;                      </xsl:text>
+            </xsl:if>
+            <xsl:choose>
+                <xsl:when test="@maxOccurs = 'unbounded'">
+                    <xsl:text>!m_</xsl:text>
+                    <xsl:value-of select="$camel-case-name"/>
+                    <xsl:text>.isEmpty()</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:text>hasElement</xsl:text>
+                    <xsl:call-template name="cap-first-char">
+                        <xsl:with-param name="text" select="$camel-case-name"/>
+                    </xsl:call-template>
+                    <xsl:text>()</xsl:text>
+                </xsl:otherwise>
+            </xsl:choose>
+        </xsl:for-each>
+        <xsl:text>});&endl;</xsl:text>
+
+        <xsl:for-each select="$node/xs:element[not(@use) or (@use!='deprecated')]">
+            <xsl:variable name="camel-case-name">
+                <xsl:call-template name="camel-case">
+                    <xsl:with-param name="text" select="@name"/>
+                </xsl:call-template>
+            </xsl:variable>
+            <xsl:choose>
+                <xsl:when test="@maxOccurs = 'unbounded'">
+                    <xsl:text>    if (!m_</xsl:text>
+                    <xsl:value-of select="$camel-case-name"/>
+                    <xsl:text>.isEmpty())&endl;</xsl:text>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:text>    if (m_children &amp; </xsl:text>
+                    <xsl:call-template name="cap-first-char">
+                        <xsl:with-param name="text" select="$camel-case-name"/>
+                    </xsl:call-template>
+                    <xsl:text>)&endl;</xsl:text>
+                </xsl:otherwise>
+            </xsl:choose>
+            <xsl:call-template name="binary-write-child-element-value">
+                <xsl:with-param name="indent" select="'        '"/>
+            </xsl:call-template>
+        </xsl:for-each>
+    </xsl:template>
+
+    <xsl:template name="binary-write-impl">
+        <xsl:param name="node"/>
+        <xsl:variable name="name" select="concat('Dom', $node/@name)"/>
+        <xsl:variable name="groups" select="$node/xs:sequence[xs:element] | $node/xs:choice | $node/xs:all[xs:element]"/>
+
+        <xsl:text>void </xsl:text>
+        <xsl:value-of select="$name"/>
+        <xsl:text>::write(QUiBinaryWriter &amp;writer) const&endl;</xsl:text>
+        <xsl:text>{&endl;</xsl:text>
+
+        <xsl:call-template name="binary-write-impl-save-attributes">
+            <xsl:with-param name="node" select="$node"/>
+        </xsl:call-template>
+
+        <xsl:for-each select="$groups">
+            <xsl:choose>
+                <xsl:when test="self::xs:choice">
+                    <xsl:call-template name="binary-write-impl-save-choice-child-element">
+                        <xsl:with-param name="node" select="."/>
+                    </xsl:call-template>
+                </xsl:when>
+                <xsl:otherwise>
+                    <xsl:call-template name="binary-write-impl-save-sequence-child-element">
+                        <xsl:with-param name="node" select="."/>
+                    </xsl:call-template>
+                </xsl:otherwise>
+            </xsl:choose>
+        </xsl:for-each>
+
+        <xsl:if test="$node[@mixed='true']">
+            <xsl:text>    writer.writeValue(m_text);&endl;</xsl:text>
+        </xsl:if>
+
+        <xsl:if test="not($node/xs:attribute) and not($groups) and not($node[@mixed='true'])">
+            <xsl:text>    Q_UNUSED(writer);&endl;</xsl:text>
+        </xsl:if>
+
+        <xsl:text>}&endl;&endl;</xsl:text>
+    </xsl:template>
+
 <!-- Implementation: child element setters -->
 
     <xsl:template name="child-setter-impl-helper">
@@ -799,6 +1356,14 @@
             <xsl:with-param name="node" select="$node"/>
         </xsl:call-template>
 
+        <xsl:call-template name="binary-read-impl">
+            <xsl:with-param name="node" select="$node"/>
+        </xsl:call-template>
+
+        <xsl:call-template name="binary-write-impl">
+            <xsl:with-param name="node" select="$node"/>
+        </xsl:call-template>
+
         <xsl:call-template name="child-setter-impl">
             <xsl:with-param name="node" select="$node"/>
         </xsl:call-template>
@@ -818,7 +1383,7 @@
 
 </xsl:text>
         <xsl:text>#include "@HEADER@"&endl;</xsl:text>
-        <xsl:text>&endl;</xsl:text>
+        <xsl:text>#include "uibinaryformat_p.h"&endl;</xsl:text>
         <xsl:text>&endl;</xsl:text>
         <xsl:text>QT_BEGIN_NAMESPACE&endl;</xsl:text>
         <xsl:text>&endl;using namespace Qt::StringLiterals;&endl;&endl;</xsl:text>
@@ -828,6 +1393,10 @@
         <xsl:text>#endif&endl;</xsl:text>
         <xsl:text>&endl;</xsl:text>
 
+        <xsl:call-template name="name-tokens">
+            <xsl:with-param name="node" select="."/>
+        </xsl:call-template>
+
         <xsl:text>/*******************************************************************************&endl;</xsl:text>
         <xsl:text>** Implementations&endl;</xsl:text>
         <xsl:text>*/&endl;&endl;</xsl:text>
@@ -314,6 +314,8 @@ namespace qdesigner_internal {
 
         // Change the name in the data base and change all referencing objects in the meta database
         dbItem->setName(newClassName);
+        if (WidgetDataBase *wdb = qobject_cast<WidgetDataBase *>(widgetDataBase))
+            wdb->updateClassNameIndex();
         bool foundReferences = false;
         const QObjectList &dbObjects = metaDataBase->objects();
         for (QObject* object : dbObjects) {
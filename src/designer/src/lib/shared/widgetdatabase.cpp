@@ -3,6 +3,7 @@
 
 #include "widgetdatabase_p.h"
 #include "widgetfactory_p.h"
+#include "metadatabase_p.h"
 #include "spacer_widget_p.h"
 #include "abstractlanguage.h"
 #include "pluginmanager_p.h"
@@ -338,18 +339,69 @@ QDesignerFormEditorInterface *WidgetDataBase::core() const
 
 int WidgetDataBase::indexOfObject(QObject *object, bool /*resolveName*/) const
 {
+    if (!object)
+        return -1;
+
     QExtensionManager *mgr = m_core->extensionManager();
     QDesignerLanguageExtension *lang = qt_extension<QDesignerLanguageExtension*> (mgr, m_core);
 
-    QString id;
+    if (lang) {
+        const QString id = lang->classNameOf(object);
+        if (!id.isEmpty())
+            return indexOfClassName(id);
+    }
+
+    // Promotion is per object, everything else WidgetFactory::classNameOf()
+    // looks at depends on the class only.
+    if (object->isWidgetType()) {
+        const QString customClassName = promotedCustomClassName(m_core, static_cast<QWidget *>(object));
+        if (!customClassName.isEmpty())
+            return indexOfClassName(customClassName);
+    }
+
+    const QMetaObject *metaObject = object->metaObject();
+    const auto it = m_metaObjectIndex.constFind(metaObject);
+    if (it != m_metaObjectIndex.constEnd())
+        return it.value();
+
+    const int index = indexOfClassName(WidgetFactory::classNameOf(m_core, object));
+    m_metaObjectIndex.insert(metaObject, index);
+    return index;
+}
+
+int WidgetDataBase::indexOfClassName(const QString &className, bool /*resolveName*/) const
+{
+    // The name check keeps an item renamed without updateClassNameIndex()
+    // from being found by its old name.
+    const auto it = m_classNameIndex.constFind(className);
+    if (it == m_classNameIndex.constEnd() || m_items.at(it.value())->name() != className)
+        return -1;
+    return it.value();
+}
 
-    if (lang)
-        id = lang->classNameOf(object);
+void WidgetDataBase::updateClassNameIndex()
+{
+    m_classNameIndex.clear();
+    m_classNameIndex.reserve(m_items.size());
+    // Keep the first of duplicated names, as a linear search would
+    for (qsizetype i = m_items.size() - 1; i >= 0; --i)
+        m_classNameIndex.insert(m_items.at(i)->name(), int(i));
+    m_metaObjectIndex.clear();
+}
 
-    if (id.isEmpty())
-        id = WidgetFactory::classNameOf(m_core,object);
+void WidgetDataBase::insert(int index, QDesignerWidgetDataBaseItemInterface *item)
+{
+    QDesignerWidgetDataBaseInterface::insert(index, item);
+    updateClassNameIndex();
+}
 
-    return QDesignerWidgetDataBaseInterface::indexOfClassName(id);
+void WidgetDataBase::append(QDesignerWidgetDataBaseItemInterface *item)
+{
+    QDesignerWidgetDataBaseInterface::append(item);
+    // Appending does not move existing items, just add the new name
+    if (!m_classNameIndex.contains(item->name()))
+        m_classNameIndex.insert(item->name(), int(m_items.size() - 1));
+    m_metaObjectIndex.clear();
 }
 
 static WidgetDataBaseItem *createCustomWidgetItem(const QDesignerCustomWidgetInterface *c,
@@ -413,6 +465,7 @@ void WidgetDataBase::loadPlugins()
                 const int existingIndex = existingIt.value();
                 delete m_items[existingIndex];
                 m_items[existingIndex] = pluginItem;
+                updateClassNameIndex();
                 existingCustomClasses.erase(existingIt);
                 replacedPlugins++;
 
@@ -438,6 +491,7 @@ void WidgetDataBase::remove(int index)
 {
     Q_ASSERT(index < m_items.size());
     delete m_items.takeAt(index);
+    updateClassNameIndex();
 }
 
 QList<QVariant> WidgetDataBase::defaultPropertyValues(const QString &name)
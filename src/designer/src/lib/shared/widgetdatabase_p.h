@@ -21,6 +21,7 @@
 #include <QtDesigner/abstractwidgetdatabase.h>
 
 #include <QtGui/qicon.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qvariant.h>
 #include <QtCore/qpair.h>
@@ -130,9 +131,15 @@ public:
     QDesignerFormEditorInterface *core() const override;
 
     int indexOfObject(QObject *o, bool resolveName = true) const override;
+    int indexOfClassName(const QString &className, bool resolveName = true) const override;
 
+    void insert(int index, QDesignerWidgetDataBaseItemInterface *item) override;
+    void append(QDesignerWidgetDataBaseItemInterface *item) override;
     void remove(int index);
 
+    // Call after changing the name of an item.
+    void updateClassNameIndex();
+
 
     void grabDefaultPropertyValues();
     void grabStandardWidgetBoxIcons();
@@ -152,6 +159,9 @@ private:
     QList<QVariant> defaultPropertyValues(const QString &name);
 
     QDesignerFormEditorInterface *m_core;
+    QHash<QString, int> m_classNameIndex;
+    // Index of non-promoted objects by class, as resolved by WidgetFactory::classNameOf()
+    mutable QHash<const QMetaObject *, int> m_metaObjectIndex;
 };
 
 QDESIGNER_SHARED_EXPORT QDesignerWidgetDataBaseItemInterface
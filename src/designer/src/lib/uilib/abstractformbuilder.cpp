@@ -880,7 +880,7 @@ void QAbstractFormBuilder::applyProperties(QObject *o, const QList<DomProperty*>
             if (attributeName == QLatin1String("numDigits") && o->inherits("QLCDNumber")) // Deprecated in Qt 4, removed in Qt 5.
                 attributeName = QLatin1String("digitCount");
             if (!d->applyPropertyInternally(o, attributeName, v))
-                o->setProperty(attributeName.toUtf8(), v);
+                d->setObjectProperty(o, attributeName, v);
         }
     }
 }
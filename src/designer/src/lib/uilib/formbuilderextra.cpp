@@ -6,6 +6,7 @@
 #include "properties_p.h"
 #include "resourcebuilder_p.h"
 #include "textbuilder_p.h"
+#include "uibinaryformat_p.h"
 #include "ui4_p.h"
 
 #include <QtWidgets/qlabel.h>
@@ -125,8 +126,11 @@ static bool inline readUiAttributes(QXmlStreamReader &reader, const QString &lan
 
 DomUI *QFormBuilderExtra::readUi(QIODevice *dev)
 {
-    QXmlStreamReader reader(dev);
     m_errorString.clear();
+    if (QUiBinaryFormat::canRead(dev))
+        return readBinaryUi(dev);
+
+    QXmlStreamReader reader(dev);
     if (!readUiAttributes(reader, m_language, &m_errorString)) {
         uiLibWarning(m_errorString);
         return nullptr;
@@ -142,6 +146,25 @@ DomUI *QFormBuilderExtra::readUi(QIODevice *dev)
     return ui;
 }
 
+DomUI *QFormBuilderExtra::readBinaryUi(QIODevice *dev)
+{
+    DomUI *ui = QUiBinaryFormat::read(dev, &m_errorString);
+    if (ui && ui->hasAttributeLanguage()) {
+        const QString formLanguage = ui->attributeLanguage();
+        if (!formLanguage.isEmpty() && formLanguage.compare(m_language, Qt::CaseInsensitive)) {
+            m_errorString =
+                QCoreApplication::translate("QAbstractFormBuilder",
+                                            "This file cannot be read because it was created using %1.")
+                                            .arg(formLanguage);
+            delete ui;
+            ui = nullptr;
+        }
+    }
+    if (!ui)
+        uiLibWarning(m_errorString);
+    return ui;
+}
+
 QString QFormBuilderExtra::msgInvalidUiFile()
 {
     return QCoreApplication::translate("QAbstractFormBuilder", "Invalid UI file");
@@ -158,6 +181,48 @@ bool QFormBuilderExtra::applyPropertyInternally(QObject *o, const QString &prope
     return true;
 }
 
+QFormBuilderExtra::PropertyInfo &QFormBuilderExtra::propertyInfo(const QMetaObject *meta,
+                                                                 const QString &propertyName)
+{
+    const auto key = qMakePair(meta, propertyName);
+    auto it = m_propertyInfos.find(key);
+    if (it == m_propertyInfos.end()) {
+        PropertyInfo info;
+        info.index = meta->indexOfProperty(propertyName.toUtf8());
+        if (info.index != -1)
+            info.property = meta->property(info.index);
+        it = m_propertyInfos.insert(key, info);
+    }
+    return it.value();
+}
+
+int QFormBuilderExtra::enumValue(PropertyInfo &info, const QString &key)
+{
+    auto it = info.enumValues.constFind(key);
+    if (it == info.enumValues.constEnd())
+        it = info.enumValues.insert(key, info.property.enumerator().keyToValue(key.toUtf8()));
+    return it.value();
+}
+
+int QFormBuilderExtra::flagValue(PropertyInfo &info, const QString &keys)
+{
+    auto it = info.flagValues.constFind(keys);
+    if (it == info.flagValues.constEnd())
+        it = info.flagValues.insert(keys, info.property.enumerator().keysToValue(keys.toUtf8()));
+    return it.value();
+}
+
+// Equivalent to QObject::setProperty() with the property looked up in the cache
+void QFormBuilderExtra::setObjectProperty(QObject *o, const QString &propertyName,
+                                          const QVariant &value)
+{
+    const PropertyInfo &info = propertyInfo(o->metaObject(), propertyName);
+    if (info.index != -1 && info.property.isWritable())
+        info.property.write(o, value);
+    else
+        o->setProperty(propertyName.toUtf8(), value);
+}
+
 void QFormBuilderExtra::applyInternalProperties() const
 {
     if (m_buddies.isEmpty())
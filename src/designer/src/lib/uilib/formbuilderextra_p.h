@@ -18,6 +18,7 @@
 #include "uilib_global.h"
 
 #include <QtCore/qhash.h>
+#include <QtCore/qmetaobject.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qstringlist.h>
 #include <QtCore/qmap.h>
@@ -75,10 +76,23 @@ public:
     void clear();
 
     DomUI *readUi(QIODevice *dev);
+    DomUI *readBinaryUi(QIODevice *dev);
     static QString msgInvalidUiFile();
 
     bool applyPropertyInternally(QObject *o, const QString &propertyName, const QVariant &value);
 
+    // Property lookups by name, cached per meta object for repeated loads
+    struct PropertyInfo {
+        int index = -1;
+        QMetaProperty property;
+        QHash<QString, int> enumValues; // keyToValue()
+        QHash<QString, int> flagValues; // keysToValue()
+    };
+    PropertyInfo &propertyInfo(const QMetaObject *meta, const QString &propertyName);
+    static int enumValue(PropertyInfo &info, const QString &key);
+    static int flagValue(PropertyInfo &info, const QString &keys);
+    void setObjectProperty(QObject *o, const QString &propertyName, const QVariant &value);
+
     enum BuddyMode { BuddyApplyAll, BuddyApplyVisibleOnly };
 
     void applyInternalProperties() const;
@@ -172,6 +186,8 @@ private:
 
     QPointer<QWidget> m_parentWidget;
     bool m_parentWidgetIsSet = false;
+
+    QHash<QPair<const QMetaObject *, QString>, PropertyInfo> m_propertyInfos;
 };
 
 void uiLibWarning(const QString &message);
@@ -38,8 +38,8 @@ QVariant domPropertyToVariant(QAbstractFormBuilder *afb,const QMetaObject *meta,
     // Complex types that need functions from QAbstractFormBuilder
     switch(p->kind()) {
     case DomProperty::String: {
-        const int index = meta->indexOfProperty(p->attributeName().toUtf8());
-        if (index != -1 && meta->property(index).metaType().id() == QMetaType::QKeySequence)
+        const QFormBuilderExtra::PropertyInfo &info = afb->d->propertyInfo(meta, p->attributeName());
+        if (info.index != -1 && info.property.metaType().id() == QMetaType::QKeySequence)
             return QVariant::fromValue(QKeySequence(p->elementString()->text()));
     }
         break;
@@ -62,38 +62,34 @@ QVariant domPropertyToVariant(QAbstractFormBuilder *afb,const QMetaObject *meta,
     }
 
     case DomProperty::Set: {
-        const QByteArray pname = p->attributeName().toUtf8();
-        const int index = meta->indexOfProperty(pname);
-        if (index == -1) {
+        QFormBuilderExtra::PropertyInfo &info = afb->d->propertyInfo(meta, p->attributeName());
+        if (info.index == -1) {
             uiLibWarning(QCoreApplication::translate("QFormBuilder", "The set-type property %1 could not be read.").arg(p->attributeName()));
             return QVariant();
         }
 
-        const QMetaEnum e = meta->property(index).enumerator();
-        Q_ASSERT(e.isFlag() == true);
-        return QVariant(e.keysToValue(p->elementSet().toUtf8()));
+        Q_ASSERT(info.property.enumerator().isFlag() == true);
+        return QVariant(QFormBuilderExtra::flagValue(info, p->elementSet()));
     }
 
     case DomProperty::Enum: {
-        const QByteArray pname = p->attributeName().toUtf8();
-        const int index = meta->indexOfProperty(pname);
+        QFormBuilderExtra::PropertyInfo &info = afb->d->propertyInfo(meta, p->attributeName());
         QString enumValue = p->elementEnum();
         // Triggers in case of objects in Designer like Spacer/Line for which properties
         // are serialized using language introspection. On preview, however, these objects are
         // emulated by hacks in the formbuilder (size policy/orientation)
         fixEnum(enumValue);
-        if (index == -1) {
+        if (info.index == -1) {
             // ### special-casing for Line (QFrame) -- fix for 4.2. Jambi hack for enumerations
             if (!qstrcmp(meta->className(), "QFrame")
-                && (pname == QByteArray("orientation"))) {
+                && p->attributeName() == QLatin1String("orientation")) {
                 return QVariant(enumValue == QFormBuilderStrings::instance().horizontalPostFix ? QFrame::HLine : QFrame::VLine);
             }
             uiLibWarning(QCoreApplication::translate("QFormBuilder", "The enumeration-type property %1 could not be read.").arg(p->attributeName()));
             return QVariant();
         }
 
-        const QMetaEnum e = meta->property(index).enumerator();
-        return QVariant(e.keyToValue(enumValue.toUtf8()));
+        return QVariant(QFormBuilderExtra::enumValue(info, enumValue));
     }
     case DomProperty::Brush:
         return QVariant::fromValue(afb->setupBrush(p->elementBrush()));
@@ -4,7 +4,7 @@
 // THIS FILE IS AUTOMATICALLY GENERATED. DO NOT EDIT!
 
 #include "ui4_p.h"
-
+#include "uibinaryformat_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -14,6 +14,951 @@ using namespace Qt::StringLiterals;
 using namespace QFormInternal;
 #endif
 
+namespace {
+
+enum class UiElement {
+    Unknown,
+    Action,
+    Actiongroup,
+    Active,
+    Activeoff,
+    Activeon,
+    Addaction,
+    Addpagemethod,
+    Antialiasing,
+    Attribute,
+    Author,
+    Blue,
+    Bold,
+    Bool,
+    Brush,
+    Buttongroup,
+    Buttongroups,
+    Char,
+    Class,
+    Color,
+    Colorrole,
+    Column,
+    Comment,
+    Connection,
+    Connections,
+    Container,
+    Cstring,
+    Cursor,
+    Cursorshape,
+    Customwidget,
+    Customwidgets,
+    Date,
+    Datetime,
+    Day,
+    Designerdata,
+    Disabled,
+    Disabledoff,
+    Disabledon,
+    Double,
+    Enum,
+    Exportmacro,
+    Extends,
+    Family,
+    Float,
+    Font,
+    Gradient,
+    Gradientstop,
+    Green,
+    Header,
+    Height,
+    Hint,
+    Hints,
+    Horstretch,
+    Hour,
+    Hsizetype,
+    Iconset,
+    Images,
+    Inactive,
+    Include,
+    Includes,
+    Italic,
+    Item,
+    Kerning,
+    Layout,
+    Layoutdefault,
+    Layoutfunction,
+    Locale,
+    Longlong,
+    Minute,
+    Month,
+    Normaloff,
+    Normalon,
+    Number,
+    Palette,
+    Pixmap,
+    Pixmapfunction,
+    Point,
+    Pointf,
+    Pointsize,
+    Properties,
+    Property,
+    Propertyspecifications,
+    Receiver,
+    Rect,
+    Rectf,
+    Red,
+    Resources,
+    Row,
+    Script,
+    Second,
+    Selectedoff,
+    Selectedon,
+    Sender,
+    Set,
+    Signal,
+    Size,
+    Sizef,
+    Sizehint,
+    Sizepolicy,
+    Slot,
+    Slots,
+    Spacer,
+    Strikeout,
+    String,
+    Stringlist,
+    Stringpropertyspecification,
+    Stylestrategy,
+    Tabstop,
+    Tabstops,
+    Texture,
+    Time,
+    Tooltip,
+    Uint,
+    Ulonglong,
+    Underline,
+    Unicode,
+    Url,
+    Verstretch,
+    Vsizetype,
+    Weight,
+    Widget,
+    Widgetdata,
+    Width,
+    X,
+    Y,
+    Year,
+    Zorder
+};
+
+UiElement uiElement(QStringView name)
+{
+    switch (name.size()) {
+    case 1:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'x':
+            if (!name.compare(u"x"_s, Qt::CaseInsensitive))
+                return UiElement::X;
+            break;
+        case u'y':
+            if (!name.compare(u"y"_s, Qt::CaseInsensitive))
+                return UiElement::Y;
+            break;
+        }
+        break;
+    case 3:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'd':
+            if (!name.compare(u"day"_s, Qt::CaseInsensitive))
+                return UiElement::Day;
+            break;
+        case u'r':
+            if (!name.compare(u"red"_s, Qt::CaseInsensitive))
+                return UiElement::Red;
+            if (!name.compare(u"row"_s, Qt::CaseInsensitive))
+                return UiElement::Row;
+            break;
+        case u's':
+            if (!name.compare(u"set"_s, Qt::CaseInsensitive))
+                return UiElement::Set;
+            break;
+        case u'u':
+            if (!name.compare(u"url"_s, Qt::CaseInsensitive))
+                return UiElement::Url;
+            break;
+        }
+        break;
+    case 4:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'b':
+            if (!name.compare(u"blue"_s, Qt::CaseInsensitive))
+                return UiElement::Blue;
+            if (!name.compare(u"bold"_s, Qt::CaseInsensitive))
+                return UiElement::Bold;
+            if (!name.compare(u"bool"_s, Qt::CaseInsensitive))
+                return UiElement::Bool;
+            break;
+        case u'c':
+            if (!name.compare(u"char"_s, Qt::CaseInsensitive))
+                return UiElement::Char;
+            break;
+        case u'd':
+            if (!name.compare(u"date"_s, Qt::CaseInsensitive))
+                return UiElement::Date;
+            break;
+        case u'e':
+            if (!name.compare(u"enum"_s, Qt::CaseInsensitive))
+                return UiElement::Enum;
+            break;
+        case u'f':
+            if (!name.compare(u"font"_s, Qt::CaseInsensitive))
+                return UiElement::Font;
+            break;
+        case u'h':
+            if (!name.compare(u"hint"_s, Qt::CaseInsensitive))
+                return UiElement::Hint;
+            if (!name.compare(u"hour"_s, Qt::CaseInsensitive))
+                return UiElement::Hour;
+            break;
+        case u'i':
+            if (!name.compare(u"item"_s, Qt::CaseInsensitive))
+                return UiElement::Item;
+            break;
+        case u'r':
+            if (!name.compare(u"rect"_s, Qt::CaseInsensitive))
+                return UiElement::Rect;
+            break;
+        case u's':
+            if (!name.compare(u"size"_s, Qt::CaseInsensitive))
+                return UiElement::Size;
+            if (!name.compare(u"slot"_s, Qt::CaseInsensitive))
+                return UiElement::Slot;
+            break;
+        case u't':
+            if (!name.compare(u"time"_s, Qt::CaseInsensitive))
+                return UiElement::Time;
+            break;
+        case u'u':
+            if (!name.compare(u"uint"_s, Qt::CaseInsensitive))
+                return UiElement::Uint;
+            break;
+        case u'y':
+            if (!name.compare(u"year"_s, Qt::CaseInsensitive))
+                return UiElement::Year;
+            break;
+        }
+        break;
+    case 5:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'b':
+            if (!name.compare(u"brush"_s, Qt::CaseInsensitive))
+                return UiElement::Brush;
+            break;
+        case u'c':
+            if (!name.compare(u"class"_s, Qt::CaseInsensitive))
+                return UiElement::Class;
+            if (!name.compare(u"color"_s, Qt::CaseInsensitive))
+                return UiElement::Color;
+            break;
+        case u'f':
+            if (!name.compare(u"float"_s, Qt::CaseInsensitive))
+                return UiElement::Float;
+            break;
+        case u'g':
+            if (!name.compare(u"green"_s, Qt::CaseInsensitive))
+                return UiElement::Green;
+            break;
+        case u'h':
+            if (!name.compare(u"hints"_s, Qt::CaseInsensitive))
+                return UiElement::Hints;
+            break;
+        case u'm':
+            if (!name.compare(u"month"_s, Qt::CaseInsensitive))
+                return UiElement::Month;
+            break;
+        case u'p':
+            if (!name.compare(u"point"_s, Qt::CaseInsensitive))
+                return UiElement::Point;
+            break;
+        case u'r':
+            if (!name.compare(u"rectf"_s, Qt::CaseInsensitive))
+                return UiElement::Rectf;
+            break;
+        case u's':
+            if (!name.compare(u"sizef"_s, Qt::CaseInsensitive))
+                return UiElement::Sizef;
+            if (!name.compare(u"slots"_s, Qt::CaseInsensitive))
+                return UiElement::Slots;
+            break;
+        case u'w':
+            if (!name.compare(u"width"_s, Qt::CaseInsensitive))
+                return UiElement::Width;
+            break;
+        }
+        break;
+    case 6:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"action"_s, Qt::CaseInsensitive))
+                return UiElement::Action;
+            if (!name.compare(u"active"_s, Qt::CaseInsensitive))
+                return UiElement::Active;
+            if (!name.compare(u"author"_s, Qt::CaseInsensitive))
+                return UiElement::Author;
+            break;
+        case u'c':
+            if (!name.compare(u"column"_s, Qt::CaseInsensitive))
+                return UiElement::Column;
+            if (!name.compare(u"cursor"_s, Qt::CaseInsensitive))
+                return UiElement::Cursor;
+            break;
+        case u'd':
+            if (!name.compare(u"double"_s, Qt::CaseInsensitive))
+                return UiElement::Double;
+            break;
+        case u'f':
+            if (!name.compare(u"family"_s, Qt::CaseInsensitive))
+                return UiElement::Family;
+            break;
+        case u'h':
+            if (!name.compare(u"header"_s, Qt::CaseInsensitive))
+                return UiElement::Header;
+            if (!name.compare(u"height"_s, Qt::CaseInsensitive))
+                return UiElement::Height;
+            break;
+        case u'i':
+            if (!name.compare(u"images"_s, Qt::CaseInsensitive))
+                return UiElement::Images;
+            if (!name.compare(u"italic"_s, Qt::CaseInsensitive))
+                return UiElement::Italic;
+            break;
+        case u'l':
+            if (!name.compare(u"layout"_s, Qt::CaseInsensitive))
+                return UiElement::Layout;
+            if (!name.compare(u"locale"_s, Qt::CaseInsensitive))
+                return UiElement::Locale;
+            break;
+        case u'm':
+            if (!name.compare(u"minute"_s, Qt::CaseInsensitive))
+                return UiElement::Minute;
+            break;
+        case u'n':
+            if (!name.compare(u"number"_s, Qt::CaseInsensitive))
+                return UiElement::Number;
+            break;
+        case u'p':
+            if (!name.compare(u"pixmap"_s, Qt::CaseInsensitive))
+                return UiElement::Pixmap;
+            if (!name.compare(u"pointf"_s, Qt::CaseInsensitive))
+                return UiElement::Pointf;
+            break;
+        case u's':
+            if (!name.compare(u"script"_s, Qt::CaseInsensitive))
+                return UiElement::Script;
+            if (!name.compare(u"second"_s, Qt::CaseInsensitive))
+                return UiElement::Second;
+            if (!name.compare(u"sender"_s, Qt::CaseInsensitive))
+                return UiElement::Sender;
+            if (!name.compare(u"signal"_s, Qt::CaseInsensitive))
+                return UiElement::Signal;
+            if (!name.compare(u"spacer"_s, Qt::CaseInsensitive))
+                return UiElement::Spacer;
+            if (!name.compare(u"string"_s, Qt::CaseInsensitive))
+                return UiElement::String;
+            break;
+        case u'w':
+            if (!name.compare(u"weight"_s, Qt::CaseInsensitive))
+                return UiElement::Weight;
+            if (!name.compare(u"widget"_s, Qt::CaseInsensitive))
+                return UiElement::Widget;
+            break;
+        case u'z':
+            if (!name.compare(u"zorder"_s, Qt::CaseInsensitive))
+                return UiElement::Zorder;
+            break;
+        }
+        break;
+    case 7:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'c':
+            if (!name.compare(u"comment"_s, Qt::CaseInsensitive))
+                return UiElement::Comment;
+            if (!name.compare(u"cstring"_s, Qt::CaseInsensitive))
+                return UiElement::Cstring;
+            break;
+        case u'e':
+            if (!name.compare(u"extends"_s, Qt::CaseInsensitive))
+                return UiElement::Extends;
+            break;
+        case u'i':
+            if (!name.compare(u"iconset"_s, Qt::CaseInsensitive))
+                return UiElement::Iconset;
+            if (!name.compare(u"include"_s, Qt::CaseInsensitive))
+                return UiElement::Include;
+            break;
+        case u'k':
+            if (!name.compare(u"kerning"_s, Qt::CaseInsensitive))
+                return UiElement::Kerning;
+            break;
+        case u'p':
+            if (!name.compare(u"palette"_s, Qt::CaseInsensitive))
+                return UiElement::Palette;
+            break;
+        case u't':
+            if (!name.compare(u"tabstop"_s, Qt::CaseInsensitive))
+                return UiElement::Tabstop;
+            if (!name.compare(u"texture"_s, Qt::CaseInsensitive))
+                return UiElement::Texture;
+            if (!name.compare(u"tooltip"_s, Qt::CaseInsensitive))
+                return UiElement::Tooltip;
+            break;
+        case u'u':
+            if (!name.compare(u"unicode"_s, Qt::CaseInsensitive))
+                return UiElement::Unicode;
+            break;
+        }
+        break;
+    case 8:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"activeon"_s, Qt::CaseInsensitive))
+                return UiElement::Activeon;
+            break;
+        case u'd':
+            if (!name.compare(u"datetime"_s, Qt::CaseInsensitive))
+                return UiElement::Datetime;
+            if (!name.compare(u"disabled"_s, Qt::CaseInsensitive))
+                return UiElement::Disabled;
+            break;
+        case u'g':
+            if (!name.compare(u"gradient"_s, Qt::CaseInsensitive))
+                return UiElement::Gradient;
+            break;
+        case u'i':
+            if (!name.compare(u"inactive"_s, Qt::CaseInsensitive))
+                return UiElement::Inactive;
+            if (!name.compare(u"includes"_s, Qt::CaseInsensitive))
+                return UiElement::Includes;
+            break;
+        case u'l':
+            if (!name.compare(u"longlong"_s, Qt::CaseInsensitive))
+                return UiElement::Longlong;
+            break;
+        case u'n':
+            if (!name.compare(u"normalon"_s, Qt::CaseInsensitive))
+                return UiElement::Normalon;
+            break;
+        case u'p':
+            if (!name.compare(u"property"_s, Qt::CaseInsensitive))
+                return UiElement::Property;
+            break;
+        case u'r':
+            if (!name.compare(u"receiver"_s, Qt::CaseInsensitive))
+                return UiElement::Receiver;
+            break;
+        case u's':
+            if (!name.compare(u"sizehint"_s, Qt::CaseInsensitive))
+                return UiElement::Sizehint;
+            break;
+        case u't':
+            if (!name.compare(u"tabstops"_s, Qt::CaseInsensitive))
+                return UiElement::Tabstops;
+            break;
+        }
+        break;
+    case 9:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"activeoff"_s, Qt::CaseInsensitive))
+                return UiElement::Activeoff;
+            if (!name.compare(u"addaction"_s, Qt::CaseInsensitive))
+                return UiElement::Addaction;
+            if (!name.compare(u"attribute"_s, Qt::CaseInsensitive))
+                return UiElement::Attribute;
+            break;
+        case u'c':
+            if (!name.compare(u"colorrole"_s, Qt::CaseInsensitive))
+                return UiElement::Colorrole;
+            if (!name.compare(u"container"_s, Qt::CaseInsensitive))
+                return UiElement::Container;
+            break;
+        case u'h':
+            if (!name.compare(u"hsizetype"_s, Qt::CaseInsensitive))
+                return UiElement::Hsizetype;
+            break;
+        case u'n':
+            if (!name.compare(u"normaloff"_s, Qt::CaseInsensitive))
+                return UiElement::Normaloff;
+            break;
+        case u'p':
+            if (!name.compare(u"pointsize"_s, Qt::CaseInsensitive))
+                return UiElement::Pointsize;
+            break;
+        case u'r':
+            if (!name.compare(u"resources"_s, Qt::CaseInsensitive))
+                return UiElement::Resources;
+            break;
+        case u's':
+            if (!name.compare(u"strikeout"_s, Qt::CaseInsensitive))
+                return UiElement::Strikeout;
+            break;
+        case u'u':
+            if (!name.compare(u"ulonglong"_s, Qt::CaseInsensitive))
+                return UiElement::Ulonglong;
+            if (!name.compare(u"underline"_s, Qt::CaseInsensitive))
+                return UiElement::Underline;
+            break;
+        case u'v':
+            if (!name.compare(u"vsizetype"_s, Qt::CaseInsensitive))
+                return UiElement::Vsizetype;
+            break;
+        }
+        break;
+    case 10:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'c':
+            if (!name.compare(u"connection"_s, Qt::CaseInsensitive))
+                return UiElement::Connection;
+            break;
+        case u'd':
+            if (!name.compare(u"disabledon"_s, Qt::CaseInsensitive))
+                return UiElement::Disabledon;
+            break;
+        case u'h':
+            if (!name.compare(u"horstretch"_s, Qt::CaseInsensitive))
+                return UiElement::Horstretch;
+            break;
+        case u'p':
+            if (!name.compare(u"properties"_s, Qt::CaseInsensitive))
+                return UiElement::Properties;
+            break;
+        case u's':
+            if (!name.compare(u"selectedon"_s, Qt::CaseInsensitive))
+                return UiElement::Selectedon;
+            if (!name.compare(u"sizepolicy"_s, Qt::CaseInsensitive))
+                return UiElement::Sizepolicy;
+            if (!name.compare(u"stringlist"_s, Qt::CaseInsensitive))
+                return UiElement::Stringlist;
+            break;
+        case u'v':
+            if (!name.compare(u"verstretch"_s, Qt::CaseInsensitive))
+                return UiElement::Verstretch;
+            break;
+        case u'w':
+            if (!name.compare(u"widgetdata"_s, Qt::CaseInsensitive))
+                return UiElement::Widgetdata;
+            break;
+        }
+        break;
+    case 11:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"actiongroup"_s, Qt::CaseInsensitive))
+                return UiElement::Actiongroup;
+            break;
+        case u'b':
+            if (!name.compare(u"buttongroup"_s, Qt::CaseInsensitive))
+                return UiElement::Buttongroup;
+            break;
+        case u'c':
+            if (!name.compare(u"connections"_s, Qt::CaseInsensitive))
+                return UiElement::Connections;
+            if (!name.compare(u"cursorshape"_s, Qt::CaseInsensitive))
+                return UiElement::Cursorshape;
+            break;
+        case u'd':
+            if (!name.compare(u"disabledoff"_s, Qt::CaseInsensitive))
+                return UiElement::Disabledoff;
+            break;
+        case u'e':
+            if (!name.compare(u"exportmacro"_s, Qt::CaseInsensitive))
+                return UiElement::Exportmacro;
+            break;
+        case u's':
+            if (!name.compare(u"selectedoff"_s, Qt::CaseInsensitive))
+                return UiElement::Selectedoff;
+            break;
+        }
+        break;
+    case 12:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"antialiasing"_s, Qt::CaseInsensitive))
+                return UiElement::Antialiasing;
+            break;
+        case u'b':
+            if (!name.compare(u"buttongroups"_s, Qt::CaseInsensitive))
+                return UiElement::Buttongroups;
+            break;
+        case u'c':
+            if (!name.compare(u"customwidget"_s, Qt::CaseInsensitive))
+                return UiElement::Customwidget;
+            break;
+        case u'd':
+            if (!name.compare(u"designerdata"_s, Qt::CaseInsensitive))
+                return UiElement::Designerdata;
+            break;
+        case u'g':
+            if (!name.compare(u"gradientstop"_s, Qt::CaseInsensitive))
+                return UiElement::Gradientstop;
+            break;
+        }
+        break;
+    case 13:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'a':
+            if (!name.compare(u"addpagemethod"_s, Qt::CaseInsensitive))
+                return UiElement::Addpagemethod;
+            break;
+        case u'c':
+            if (!name.compare(u"customwidgets"_s, Qt::CaseInsensitive))
+                return UiElement::Customwidgets;
+            break;
+        case u'l':
+            if (!name.compare(u"layoutdefault"_s, Qt::CaseInsensitive))
+                return UiElement::Layoutdefault;
+            break;
+        case u's':
+            if (!name.compare(u"stylestrategy"_s, Qt::CaseInsensitive))
+                return UiElement::Stylestrategy;
+            break;
+        }
+        break;
+    case 14:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'l':
+            if (!name.compare(u"layoutfunction"_s, Qt::CaseInsensitive))
+                return UiElement::Layoutfunction;
+            break;
+        case u'p':
+            if (!name.compare(u"pixmapfunction"_s, Qt::CaseInsensitive))
+                return UiElement::Pixmapfunction;
+            break;
+        }
+        break;
+    case 22:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u'p':
+            if (!name.compare(u"propertyspecifications"_s, Qt::CaseInsensitive))
+                return UiElement::Propertyspecifications;
+            break;
+        }
+        break;
+    case 27:
+        switch (name.front().toCaseFolded().unicode()) {
+        case u's':
+            if (!name.compare(u"stringpropertyspecification"_s, Qt::CaseInsensitive))
+                return UiElement::Stringpropertyspecification;
+            break;
+        }
+        break;
+    }
+    return UiElement::Unknown;
+}
+
+enum class UiAttribute {
+    Unknown,
+    Alias,
+    Alignment,
+    Alpha,
+    Angle,
+    Brushstyle,
+    Centralx,
+    Centraly,
+    Class,
+    Colspan,
+    Column,
+    Columnminimumwidth,
+    Columnstretch,
+    Comment,
+    Connectslotsbyname,
+    Coordinatemode,
+    Country,
+    Displayname,
+    Endx,
+    Endy,
+    Extracomment,
+    Focalx,
+    Focaly,
+    Hsizetype,
+    Id,
+    Idbasedtr,
+    Impldecl,
+    Language,
+    Location,
+    Margin,
+    Menu,
+    Name,
+    Native,
+    Notr,
+    Position,
+    Radius,
+    Resource,
+    Role,
+    Row,
+    Rowminimumheight,
+    Rowspan,
+    Rowstretch,
+    Spacing,
+    Spread,
+    Startx,
+    Starty,
+    StdSetDef,
+    Stdset,
+    Stdsetdef,
+    Stretch,
+    Theme,
+    Type,
+    Version,
+    Vsizetype
+};
+
+UiAttribute uiAttribute(QStringView name)
+{
+    switch (name.size()) {
+    case 2:
+        switch (name.front().unicode()) {
+        case u'i':
+            if (name == u"id"_s)
+                return UiAttribute::Id;
+            break;
+        }
+        break;
+    case 3:
+        switch (name.front().unicode()) {
+        case u'r':
+            if (name == u"row"_s)
+                return UiAttribute::Row;
+            break;
+        }
+        break;
+    case 4:
+        switch (name.front().unicode()) {
+        case u'e':
+            if (name == u"endx"_s)
+                return UiAttribute::Endx;
+            if (name == u"endy"_s)
+                return UiAttribute::Endy;
+            break;
+        case u'm':
+            if (name == u"menu"_s)
+                return UiAttribute::Menu;
+            break;
+        case u'n':
+            if (name == u"name"_s)
+                return UiAttribute::Name;
+            if (name == u"notr"_s)
+                return UiAttribute::Notr;
+            break;
+        case u'r':
+            if (name == u"role"_s)
+                return UiAttribute::Role;
+            break;
+        case u't':
+            if (name == u"type"_s)
+                return UiAttribute::Type;
+            break;
+        }
+        break;
+    case 5:
+        switch (name.front().unicode()) {
+        case u'a':
+            if (name == u"alias"_s)
+                return UiAttribute::Alias;
+            if (name == u"alpha"_s)
+                return UiAttribute::Alpha;
+            if (name == u"angle"_s)
+                return UiAttribute::Angle;
+            break;
+        case u'c':
+            if (name == u"class"_s)
+                return UiAttribute::Class;
+            break;
+        case u't':
+            if (name == u"theme"_s)
+                return UiAttribute::Theme;
+            break;
+        }
+        break;
+    case 6:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"column"_s)
+                return UiAttribute::Column;
+            break;
+        case u'f':
+            if (name == u"focalx"_s)
+                return UiAttribute::Focalx;
+            if (name == u"focaly"_s)
+                return UiAttribute::Focaly;
+            break;
+        case u'm':
+            if (name == u"margin"_s)
+                return UiAttribute::Margin;
+            break;
+        case u'n':
+            if (name == u"native"_s)
+                return UiAttribute::Native;
+            break;
+        case u'r':
+            if (name == u"radius"_s)
+                return UiAttribute::Radius;
+            break;
+        case u's':
+            if (name == u"spread"_s)
+                return UiAttribute::Spread;
+            if (name == u"startx"_s)
+                return UiAttribute::Startx;
+            if (name == u"starty"_s)
+                return UiAttribute::Starty;
+            if (name == u"stdset"_s)
+                return UiAttribute::Stdset;
+            break;
+        }
+        break;
+    case 7:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"colspan"_s)
+                return UiAttribute::Colspan;
+            if (name == u"comment"_s)
+                return UiAttribute::Comment;
+            if (name == u"country"_s)
+                return UiAttribute::Country;
+            break;
+        case u'r':
+            if (name == u"rowspan"_s)
+                return UiAttribute::Rowspan;
+            break;
+        case u's':
+            if (name == u"spacing"_s)
+                return UiAttribute::Spacing;
+            if (name == u"stretch"_s)
+                return UiAttribute::Stretch;
+            break;
+        case u'v':
+            if (name == u"version"_s)
+                return UiAttribute::Version;
+            break;
+        }
+        break;
+    case 8:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"centralx"_s)
+                return UiAttribute::Centralx;
+            if (name == u"centraly"_s)
+                return UiAttribute::Centraly;
+            break;
+        case u'i':
+            if (name == u"impldecl"_s)
+                return UiAttribute::Impldecl;
+            break;
+        case u'l':
+            if (name == u"language"_s)
+                return UiAttribute::Language;
+            if (name == u"location"_s)
+                return UiAttribute::Location;
+            break;
+        case u'p':
+            if (name == u"position"_s)
+                return UiAttribute::Position;
+            break;
+        case u'r':
+            if (name == u"resource"_s)
+                return UiAttribute::Resource;
+            break;
+        }
+        break;
+    case 9:
+        switch (name.front().unicode()) {
+        case u'a':
+            if (name == u"alignment"_s)
+                return UiAttribute::Alignment;
+            break;
+        case u'h':
+            if (name == u"hsizetype"_s)
+                return UiAttribute::Hsizetype;
+            break;
+        case u'i':
+            if (name == u"idbasedtr"_s)
+                return UiAttribute::Idbasedtr;
+            break;
+        case u's':
+            if (name == u"stdSetDef"_s)
+                return UiAttribute::StdSetDef;
+            if (name == u"stdsetdef"_s)
+                return UiAttribute::Stdsetdef;
+            break;
+        case u'v':
+            if (name == u"vsizetype"_s)
+                return UiAttribute::Vsizetype;
+            break;
+        }
+        break;
+    case 10:
+        switch (name.front().unicode()) {
+        case u'b':
+            if (name == u"brushstyle"_s)
+                return UiAttribute::Brushstyle;
+            break;
+        case u'r':
+            if (name == u"rowstretch"_s)
+                return UiAttribute::Rowstretch;
+            break;
+        }
+        break;
+    case 11:
+        switch (name.front().unicode()) {
+        case u'd':
+            if (name == u"displayname"_s)
+                return UiAttribute::Displayname;
+            break;
+        }
+        break;
+    case 12:
+        switch (name.front().unicode()) {
+        case u'e':
+            if (name == u"extracomment"_s)
+                return UiAttribute::Extracomment;
+            break;
+        }
+        break;
+    case 13:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"columnstretch"_s)
+                return UiAttribute::Columnstretch;
+            break;
+        }
+        break;
+    case 14:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"coordinatemode"_s)
+                return UiAttribute::Coordinatemode;
+            break;
+        }
+        break;
+    case 16:
+        switch (name.front().unicode()) {
+        case u'r':
+            if (name == u"rowminimumheight"_s)
+                return UiAttribute::Rowminimumheight;
+            break;
+        }
+        break;
+    case 18:
+        switch (name.front().unicode()) {
+        case u'c':
+            if (name == u"columnminimumwidth"_s)
+                return UiAttribute::Columnminimumwidth;
+            if (name == u"connectslotsbyname"_s)
+                return UiAttribute::Connectslotsbyname;
+            break;
+        }
+        break;
+    }
+    return UiAttribute::Unknown;
+}
+
+} // namespace
+
 /*******************************************************************************
 ** Implementations
 */
@@ -38,33 +983,30 @@ void DomUI::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"version"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Version:
             setAttributeVersion(attribute.value().toString());
             continue;
-        }
-        if (name == u"language"_s) {
+        case UiAttribute::Language:
             setAttributeLanguage(attribute.value().toString());
             continue;
-        }
-        if (name == u"displayname"_s) {
+        case UiAttribute::Displayname:
             setAttributeDisplayname(attribute.value().toString());
             continue;
-        }
-        if (name == u"idbasedtr"_s) {
+        case UiAttribute::Idbasedtr:
             setAttributeIdbasedtr(attribute.value() == u"true"_s);
             continue;
-        }
-        if (name == u"connectslotsbyname"_s) {
+        case UiAttribute::Connectslotsbyname:
             setAttributeConnectslotsbyname(attribute.value() == u"true"_s);
             continue;
-        }
-        if (name == u"stdsetdef"_s) {
+        case UiAttribute::Stdsetdef:
             setAttributeStdsetdef(attribute.value().toInt());
             continue;
-        }
-        if (name == u"stdSetDef"_s) {
+        case UiAttribute::StdSetDef:
             setAttributeStdSetDef(attribute.value().toInt());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -73,97 +1015,95 @@ void DomUI::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"author"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Author:
                 setElementAuthor(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"comment"_s, Qt::CaseInsensitive)) {
+            case UiElement::Comment:
                 setElementComment(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"exportmacro"_s, Qt::CaseInsensitive)) {
+            case UiElement::Exportmacro:
                 setElementExportMacro(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"class"_s, Qt::CaseInsensitive)) {
+            case UiElement::Class:
                 setElementClass(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"widget"_s, Qt::CaseInsensitive)) {
+            case UiElement::Widget: {
                 auto *v = new DomWidget();
                 v->read(reader);
                 setElementWidget(v);
                 continue;
             }
-            if (!tag.compare(u"layoutdefault"_s, Qt::CaseInsensitive)) {
+            case UiElement::Layoutdefault: {
                 auto *v = new DomLayoutDefault();
                 v->read(reader);
                 setElementLayoutDefault(v);
                 continue;
             }
-            if (!tag.compare(u"layoutfunction"_s, Qt::CaseInsensitive)) {
+            case UiElement::Layoutfunction: {
                 auto *v = new DomLayoutFunction();
                 v->read(reader);
                 setElementLayoutFunction(v);
                 continue;
             }
-            if (!tag.compare(u"pixmapfunction"_s, Qt::CaseInsensitive)) {
+            case UiElement::Pixmapfunction:
                 setElementPixmapFunction(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"customwidgets"_s, Qt::CaseInsensitive)) {
+            case UiElement::Customwidgets: {
                 auto *v = new DomCustomWidgets();
                 v->read(reader);
                 setElementCustomWidgets(v);
                 continue;
             }
-            if (!tag.compare(u"tabstops"_s, Qt::CaseInsensitive)) {
+            case UiElement::Tabstops: {
                 auto *v = new DomTabStops();
                 v->read(reader);
                 setElementTabStops(v);
                 continue;
             }
-            if (!tag.compare(u"images"_s, Qt::CaseInsensitive)) {
+            case UiElement::Images:
                 qWarning("Omitting deprecated element <images>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"includes"_s, Qt::CaseInsensitive)) {
+            case UiElement::Includes: {
                 auto *v = new DomIncludes();
                 v->read(reader);
                 setElementIncludes(v);
                 continue;
             }
-            if (!tag.compare(u"resources"_s, Qt::CaseInsensitive)) {
+            case UiElement::Resources: {
                 auto *v = new DomResources();
                 v->read(reader);
                 setElementResources(v);
                 continue;
             }
-            if (!tag.compare(u"connections"_s, Qt::CaseInsensitive)) {
+            case UiElement::Connections: {
                 auto *v = new DomConnections();
                 v->read(reader);
                 setElementConnections(v);
                 continue;
             }
-            if (!tag.compare(u"designerdata"_s, Qt::CaseInsensitive)) {
+            case UiElement::Designerdata: {
                 auto *v = new DomDesignerData();
                 v->read(reader);
                 setElementDesignerdata(v);
                 continue;
             }
-            if (!tag.compare(u"slots"_s, Qt::CaseInsensitive)) {
+            case UiElement::Slots: {
                 auto *v = new DomSlots();
                 v->read(reader);
                 setElementSlots(v);
                 continue;
             }
-            if (!tag.compare(u"buttongroups"_s, Qt::CaseInsensitive)) {
+            case UiElement::Buttongroups: {
                 auto *v = new DomButtonGroups();
                 v->read(reader);
                 setElementButtonGroups(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -251,6 +1191,131 @@ void DomUI::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomUI::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeVersion(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeLanguage(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeDisplayname(reader.readValue<QString>());
+    if (attributes & (1u << 3))
+        setAttributeIdbasedtr(reader.readValue<bool>());
+    if (attributes & (1u << 4))
+        setAttributeConnectslotsbyname(reader.readValue<bool>());
+    if (attributes & (1u << 5))
+        setAttributeStdsetdef(reader.readValue<int>());
+    if (attributes & (1u << 6))
+        setAttributeStdSetDef(reader.readValue<int>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementAuthor(reader.readValue<QString>());
+    if (children & (1u << 1))
+        setElementComment(reader.readValue<QString>());
+    if (children & (1u << 2))
+        setElementExportMacro(reader.readValue<QString>());
+    if (children & (1u << 3))
+        setElementClass(reader.readValue<QString>());
+    if (children & (1u << 4))
+        setElementWidget(reader.readNode<DomWidget>());
+    if (children & (1u << 5))
+        setElementLayoutDefault(reader.readNode<DomLayoutDefault>());
+    if (children & (1u << 6))
+        setElementLayoutFunction(reader.readNode<DomLayoutFunction>());
+    if (children & (1u << 7))
+        setElementPixmapFunction(reader.readValue<QString>());
+    if (children & (1u << 8))
+        setElementCustomWidgets(reader.readNode<DomCustomWidgets>());
+    if (children & (1u << 9))
+        setElementTabStops(reader.readNode<DomTabStops>());
+    if (children & (1u << 10))
+        setElementIncludes(reader.readNode<DomIncludes>());
+    if (children & (1u << 11))
+        setElementResources(reader.readNode<DomResources>());
+    if (children & (1u << 12))
+        setElementConnections(reader.readNode<DomConnections>());
+    if (children & (1u << 13))
+        setElementDesignerdata(reader.readNode<DomDesignerData>());
+    if (children & (1u << 14))
+        setElementSlots(reader.readNode<DomSlots>());
+    if (children & (1u << 15))
+        setElementButtonGroups(reader.readNode<DomButtonGroups>());
+}
+
+void DomUI::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_version,
+                      m_has_attr_language,
+                      m_has_attr_displayname,
+                      m_has_attr_idbasedtr,
+                      m_has_attr_connectslotsbyname,
+                      m_has_attr_stdsetdef,
+                      m_has_attr_stdSetDef});
+    if (m_has_attr_version)
+        writer.writeValue(m_attr_version);
+    if (m_has_attr_language)
+        writer.writeValue(m_attr_language);
+    if (m_has_attr_displayname)
+        writer.writeValue(m_attr_displayname);
+    if (m_has_attr_idbasedtr)
+        writer.writeValue(m_attr_idbasedtr);
+    if (m_has_attr_connectslotsbyname)
+        writer.writeValue(m_attr_connectslotsbyname);
+    if (m_has_attr_stdsetdef)
+        writer.writeValue(m_attr_stdsetdef);
+    if (m_has_attr_stdSetDef)
+        writer.writeValue(m_attr_stdSetDef);
+    writer.writeMask({hasElementAuthor(),
+                      hasElementComment(),
+                      hasElementExportMacro(),
+                      hasElementClass(),
+                      hasElementWidget(),
+                      hasElementLayoutDefault(),
+                      hasElementLayoutFunction(),
+                      hasElementPixmapFunction(),
+                      hasElementCustomWidgets(),
+                      hasElementTabStops(),
+                      hasElementIncludes(),
+                      hasElementResources(),
+                      hasElementConnections(),
+                      hasElementDesignerdata(),
+                      hasElementSlots(),
+                      hasElementButtonGroups()});
+    if (m_children & Author)
+        writer.writeValue(m_author);
+    if (m_children & Comment)
+        writer.writeValue(m_comment);
+    if (m_children & ExportMacro)
+        writer.writeValue(m_exportMacro);
+    if (m_children & Class)
+        writer.writeValue(m_class);
+    if (m_children & Widget)
+        m_widget->write(writer);
+    if (m_children & LayoutDefault)
+        m_layoutDefault->write(writer);
+    if (m_children & LayoutFunction)
+        m_layoutFunction->write(writer);
+    if (m_children & PixmapFunction)
+        writer.writeValue(m_pixmapFunction);
+    if (m_children & CustomWidgets)
+        m_customWidgets->write(writer);
+    if (m_children & TabStops)
+        m_tabStops->write(writer);
+    if (m_children & Includes)
+        m_includes->write(writer);
+    if (m_children & Resources)
+        m_resources->write(writer);
+    if (m_children & Connections)
+        m_connections->write(writer);
+    if (m_children & Designerdata)
+        m_designerdata->write(writer);
+    if (m_children & Slots)
+        m_slots->write(writer);
+    if (m_children & ButtonGroups)
+        m_buttonGroups->write(writer);
+}
+
 void DomUI::setElementAuthor(const QString &a)
 {
     m_children |= Author;
@@ -560,12 +1625,16 @@ void DomIncludes::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"include"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Include: {
                 auto *v = new DomInclude();
                 v->read(reader);
                 m_include.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -587,6 +1656,20 @@ void DomIncludes::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomIncludes::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementInclude(reader.readList<DomInclude>());
+}
+
+void DomIncludes::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_include.isEmpty()});
+    if (!m_include.isEmpty())
+        writer.writeList(m_include);
+}
+
 void DomIncludes::setElementInclude(const QList<DomInclude *> &a)
 {
     m_children |= Include;
@@ -600,13 +1683,15 @@ void DomInclude::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"location"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Location:
             setAttributeLocation(attribute.value().toString());
             continue;
-        }
-        if (name == u"impldecl"_s) {
+        case UiAttribute::Impldecl:
             setAttributeImpldecl(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -646,6 +1731,27 @@ void DomInclude::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomInclude::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeLocation(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeImpldecl(reader.readValue<QString>());
+    m_text = reader.readValue<QString>();
+}
+
+void DomInclude::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_location,
+                      m_has_attr_impldecl});
+    if (m_has_attr_location)
+        writer.writeValue(m_attr_location);
+    if (m_has_attr_impldecl)
+        writer.writeValue(m_attr_impldecl);
+    writer.writeValue(m_text);
+}
+
 DomResources::~DomResources()
 {
     qDeleteAll(m_include);
@@ -657,9 +1763,12 @@ void DomResources::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -668,12 +1777,16 @@ void DomResources::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"include"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Include: {
                 auto *v = new DomResource();
                 v->read(reader);
                 m_include.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -698,6 +1811,26 @@ void DomResources::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomResources::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementInclude(reader.readList<DomResource>());
+}
+
+void DomResources::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    writer.writeMask({!m_include.isEmpty()});
+    if (!m_include.isEmpty())
+        writer.writeList(m_include);
+}
+
 void DomResources::setElementInclude(const QList<DomResource *> &a)
 {
     m_children |= Include;
@@ -711,9 +1844,12 @@ void DomResource::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"location"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Location:
             setAttributeLocation(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -743,6 +1879,20 @@ void DomResource::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomResource::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeLocation(reader.readValue<QString>());
+}
+
+void DomResource::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_location});
+    if (m_has_attr_location)
+        writer.writeValue(m_attr_location);
+}
+
 DomActionGroup::~DomActionGroup()
 {
     qDeleteAll(m_action);
@@ -760,9 +1910,12 @@ void DomActionGroup::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -771,30 +1924,34 @@ void DomActionGroup::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"action"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Action: {
                 auto *v = new DomAction();
                 v->read(reader);
                 m_action.append(v);
                 continue;
             }
-            if (!tag.compare(u"actiongroup"_s, Qt::CaseInsensitive)) {
+            case UiElement::Actiongroup: {
                 auto *v = new DomActionGroup();
                 v->read(reader);
                 m_actionGroup.append(v);
                 continue;
             }
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"attribute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Attribute: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_attribute.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -828,6 +1985,41 @@ void DomActionGroup::write(QXmlStreamWriter &writer, const QString &tagName) con
     writer.writeEndElement();
 }
 
+void DomActionGroup::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementAction(reader.readList<DomAction>());
+    if (children & (1u << 1))
+        setElementActionGroup(reader.readList<DomActionGroup>());
+    if (children & (1u << 2))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 3))
+        setElementAttribute(reader.readList<DomProperty>());
+}
+
+void DomActionGroup::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    writer.writeMask({!m_action.isEmpty(),
+                      !m_actionGroup.isEmpty(),
+                      !m_property.isEmpty(),
+                      !m_attribute.isEmpty()});
+    if (!m_action.isEmpty())
+        writer.writeList(m_action);
+    if (!m_actionGroup.isEmpty())
+        writer.writeList(m_actionGroup);
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_attribute.isEmpty())
+        writer.writeList(m_attribute);
+}
+
 void DomActionGroup::setElementAction(const QList<DomAction *> &a)
 {
     m_children |= Action;
@@ -865,13 +2057,15 @@ void DomAction::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
-        }
-        if (name == u"menu"_s) {
+        case UiAttribute::Menu:
             setAttributeMenu(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -880,18 +2074,22 @@ void DomAction::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"attribute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Attribute: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_attribute.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -922,6 +2120,36 @@ void DomAction::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomAction::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeMenu(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 1))
+        setElementAttribute(reader.readList<DomProperty>());
+}
+
+void DomAction::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name,
+                      m_has_attr_menu});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    if (m_has_attr_menu)
+        writer.writeValue(m_attr_menu);
+    writer.writeMask({!m_property.isEmpty(),
+                      !m_attribute.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_attribute.isEmpty())
+        writer.writeList(m_attribute);
+}
+
 void DomAction::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -941,9 +2169,12 @@ void DomActionRef::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -973,6 +2204,20 @@ void DomActionRef::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomActionRef::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+}
+
+void DomActionRef::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+}
+
 DomButtonGroup::~DomButtonGroup()
 {
     qDeleteAll(m_property);
@@ -986,9 +2231,12 @@ void DomButtonGroup::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -997,18 +2245,22 @@ void DomButtonGroup::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"attribute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Attribute: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_attribute.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1036,6 +2288,31 @@ void DomButtonGroup::write(QXmlStreamWriter &writer, const QString &tagName) con
     writer.writeEndElement();
 }
 
+void DomButtonGroup::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 1))
+        setElementAttribute(reader.readList<DomProperty>());
+}
+
+void DomButtonGroup::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    writer.writeMask({!m_property.isEmpty(),
+                      !m_attribute.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_attribute.isEmpty())
+        writer.writeList(m_attribute);
+}
+
 void DomButtonGroup::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -1060,12 +2337,16 @@ void DomButtonGroups::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"buttongroup"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Buttongroup: {
                 auto *v = new DomButtonGroup();
                 v->read(reader);
                 m_buttonGroup.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1087,6 +2368,20 @@ void DomButtonGroups::write(QXmlStreamWriter &writer, const QString &tagName) co
     writer.writeEndElement();
 }
 
+void DomButtonGroups::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementButtonGroup(reader.readList<DomButtonGroup>());
+}
+
+void DomButtonGroups::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_buttonGroup.isEmpty()});
+    if (!m_buttonGroup.isEmpty())
+        writer.writeList(m_buttonGroup);
+}
+
 void DomButtonGroups::setElementButtonGroup(const QList<DomButtonGroup *> &a)
 {
     m_children |= ButtonGroup;
@@ -1105,12 +2400,16 @@ void DomCustomWidgets::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"customwidget"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Customwidget: {
                 auto *v = new DomCustomWidget();
                 v->read(reader);
                 m_customWidget.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1132,6 +2431,20 @@ void DomCustomWidgets::write(QXmlStreamWriter &writer, const QString &tagName) c
     writer.writeEndElement();
 }
 
+void DomCustomWidgets::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementCustomWidget(reader.readList<DomCustomWidget>());
+}
+
+void DomCustomWidgets::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_customWidget.isEmpty()});
+    if (!m_customWidget.isEmpty())
+        writer.writeList(m_customWidget);
+}
+
 void DomCustomWidgets::setElementCustomWidget(const QList<DomCustomWidget *> &a)
 {
     m_children |= CustomWidget;
@@ -1145,9 +2458,12 @@ void DomHeader::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"location"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Location:
             setAttributeLocation(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1184,6 +2500,22 @@ void DomHeader::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomHeader::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeLocation(reader.readValue<QString>());
+    m_text = reader.readValue<QString>();
+}
+
+void DomHeader::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_location});
+    if (m_has_attr_location)
+        writer.writeValue(m_attr_location);
+    writer.writeValue(m_text);
+}
+
 DomCustomWidget::~DomCustomWidget()
 {
     delete m_header;
@@ -1198,65 +2530,61 @@ void DomCustomWidget::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"class"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Class:
                 setElementClass(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"extends"_s, Qt::CaseInsensitive)) {
+            case UiElement::Extends:
                 setElementExtends(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"header"_s, Qt::CaseInsensitive)) {
+            case UiElement::Header: {
                 auto *v = new DomHeader();
                 v->read(reader);
                 setElementHeader(v);
                 continue;
             }
-            if (!tag.compare(u"sizehint"_s, Qt::CaseInsensitive)) {
+            case UiElement::Sizehint: {
                 auto *v = new DomSize();
                 v->read(reader);
                 setElementSizeHint(v);
                 continue;
             }
-            if (!tag.compare(u"addpagemethod"_s, Qt::CaseInsensitive)) {
+            case UiElement::Addpagemethod:
                 setElementAddPageMethod(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"container"_s, Qt::CaseInsensitive)) {
+            case UiElement::Container:
                 setElementContainer(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"sizepolicy"_s, Qt::CaseInsensitive)) {
+            case UiElement::Sizepolicy:
                 qWarning("Omitting deprecated element <sizepolicy>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"pixmap"_s, Qt::CaseInsensitive)) {
+            case UiElement::Pixmap:
                 setElementPixmap(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"script"_s, Qt::CaseInsensitive)) {
+            case UiElement::Script:
                 qWarning("Omitting deprecated element <script>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"properties"_s, Qt::CaseInsensitive)) {
+            case UiElement::Properties:
                 qWarning("Omitting deprecated element <properties>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"slots"_s, Qt::CaseInsensitive)) {
+            case UiElement::Slots: {
                 auto *v = new DomSlots();
                 v->read(reader);
                 setElementSlots(v);
                 continue;
             }
-            if (!tag.compare(u"propertyspecifications"_s, Qt::CaseInsensitive)) {
+            case UiElement::Propertyspecifications: {
                 auto *v = new DomPropertySpecifications();
                 v->read(reader);
                 setElementPropertyspecifications(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1302,6 +2630,60 @@ void DomCustomWidget::write(QXmlStreamWriter &writer, const QString &tagName) co
     writer.writeEndElement();
 }
 
+void DomCustomWidget::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementClass(reader.readValue<QString>());
+    if (children & (1u << 1))
+        setElementExtends(reader.readValue<QString>());
+    if (children & (1u << 2))
+        setElementHeader(reader.readNode<DomHeader>());
+    if (children & (1u << 3))
+        setElementSizeHint(reader.readNode<DomSize>());
+    if (children & (1u << 4))
+        setElementAddPageMethod(reader.readValue<QString>());
+    if (children & (1u << 5))
+        setElementContainer(reader.readValue<int>());
+    if (children & (1u << 6))
+        setElementPixmap(reader.readValue<QString>());
+    if (children & (1u << 7))
+        setElementSlots(reader.readNode<DomSlots>());
+    if (children & (1u << 8))
+        setElementPropertyspecifications(reader.readNode<DomPropertySpecifications>());
+}
+
+void DomCustomWidget::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementClass(),
+                      hasElementExtends(),
+                      hasElementHeader(),
+                      hasElementSizeHint(),
+                      hasElementAddPageMethod(),
+                      hasElementContainer(),
+                      hasElementPixmap(),
+                      hasElementSlots(),
+                      hasElementPropertyspecifications()});
+    if (m_children & Class)
+        writer.writeValue(m_class);
+    if (m_children & Extends)
+        writer.writeValue(m_extends);
+    if (m_children & Header)
+        m_header->write(writer);
+    if (m_children & SizeHint)
+        m_sizeHint->write(writer);
+    if (m_children & AddPageMethod)
+        writer.writeValue(m_addPageMethod);
+    if (m_children & Container)
+        writer.writeValue(m_container);
+    if (m_children & Pixmap)
+        writer.writeValue(m_pixmap);
+    if (m_children & Slots)
+        m_slots->write(writer);
+    if (m_children & Propertyspecifications)
+        m_propertyspecifications->write(writer);
+}
+
 void DomCustomWidget::setElementClass(const QString &a)
 {
     m_children |= Class;
@@ -1452,13 +2834,15 @@ void DomLayoutDefault::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"spacing"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Spacing:
             setAttributeSpacing(attribute.value().toInt());
             continue;
-        }
-        if (name == u"margin"_s) {
+        case UiAttribute::Margin:
             setAttributeMargin(attribute.value().toInt());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1491,6 +2875,25 @@ void DomLayoutDefault::write(QXmlStreamWriter &writer, const QString &tagName) c
     writer.writeEndElement();
 }
 
+void DomLayoutDefault::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeSpacing(reader.readValue<int>());
+    if (attributes & (1u << 1))
+        setAttributeMargin(reader.readValue<int>());
+}
+
+void DomLayoutDefault::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_spacing,
+                      m_has_attr_margin});
+    if (m_has_attr_spacing)
+        writer.writeValue(m_attr_spacing);
+    if (m_has_attr_margin)
+        writer.writeValue(m_attr_margin);
+}
+
 DomLayoutFunction::~DomLayoutFunction() = default;
 
 void DomLayoutFunction::read(QXmlStreamReader &reader)
@@ -1498,13 +2901,15 @@ void DomLayoutFunction::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"spacing"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Spacing:
             setAttributeSpacing(attribute.value().toString());
             continue;
-        }
-        if (name == u"margin"_s) {
+        case UiAttribute::Margin:
             setAttributeMargin(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1537,6 +2942,25 @@ void DomLayoutFunction::write(QXmlStreamWriter &writer, const QString &tagName)
     writer.writeEndElement();
 }
 
+void DomLayoutFunction::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeSpacing(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeMargin(reader.readValue<QString>());
+}
+
+void DomLayoutFunction::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_spacing,
+                      m_has_attr_margin});
+    if (m_has_attr_spacing)
+        writer.writeValue(m_attr_spacing);
+    if (m_has_attr_margin)
+        writer.writeValue(m_attr_margin);
+}
+
 DomTabStops::~DomTabStops()
 {
     m_tabStop.clear();
@@ -1548,9 +2972,12 @@ void DomTabStops::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"tabstop"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Tabstop:
                 m_tabStop.append(reader.readElementText());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -1573,6 +3000,20 @@ void DomTabStops::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomTabStops::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementTabStop(reader.readValue<QStringList>());
+}
+
+void DomTabStops::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_tabStop.isEmpty()});
+    if (!m_tabStop.isEmpty())
+        writer.writeValue(m_tabStop);
+}
+
 void DomTabStops::setElementTabStop(const QStringList &a)
 {
     m_children |= TabStop;
@@ -1594,33 +3035,30 @@ void DomLayout::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"class"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Class:
             setAttributeClass(attribute.value().toString());
             continue;
-        }
-        if (name == u"name"_s) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
-        }
-        if (name == u"stretch"_s) {
+        case UiAttribute::Stretch:
             setAttributeStretch(attribute.value().toString());
             continue;
-        }
-        if (name == u"rowstretch"_s) {
+        case UiAttribute::Rowstretch:
             setAttributeRowStretch(attribute.value().toString());
             continue;
-        }
-        if (name == u"columnstretch"_s) {
+        case UiAttribute::Columnstretch:
             setAttributeColumnStretch(attribute.value().toString());
             continue;
-        }
-        if (name == u"rowminimumheight"_s) {
+        case UiAttribute::Rowminimumheight:
             setAttributeRowMinimumHeight(attribute.value().toString());
             continue;
-        }
-        if (name == u"columnminimumwidth"_s) {
+        case UiAttribute::Columnminimumwidth:
             setAttributeColumnMinimumWidth(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1629,24 +3067,28 @@ void DomLayout::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"attribute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Attribute: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_attribute.append(v);
                 continue;
             }
-            if (!tag.compare(u"item"_s, Qt::CaseInsensitive)) {
+            case UiElement::Item: {
                 auto *v = new DomLayoutItem();
                 v->read(reader);
                 m_item.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1695,6 +3137,66 @@ void DomLayout::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomLayout::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeClass(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeName(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeStretch(reader.readValue<QString>());
+    if (attributes & (1u << 3))
+        setAttributeRowStretch(reader.readValue<QString>());
+    if (attributes & (1u << 4))
+        setAttributeColumnStretch(reader.readValue<QString>());
+    if (attributes & (1u << 5))
+        setAttributeRowMinimumHeight(reader.readValue<QString>());
+    if (attributes & (1u << 6))
+        setAttributeColumnMinimumWidth(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 1))
+        setElementAttribute(reader.readList<DomProperty>());
+    if (children & (1u << 2))
+        setElementItem(reader.readList<DomLayoutItem>());
+}
+
+void DomLayout::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_class,
+                      m_has_attr_name,
+                      m_has_attr_stretch,
+                      m_has_attr_rowStretch,
+                      m_has_attr_columnStretch,
+                      m_has_attr_rowMinimumHeight,
+                      m_has_attr_columnMinimumWidth});
+    if (m_has_attr_class)
+        writer.writeValue(m_attr_class);
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    if (m_has_attr_stretch)
+        writer.writeValue(m_attr_stretch);
+    if (m_has_attr_rowStretch)
+        writer.writeValue(m_attr_rowStretch);
+    if (m_has_attr_columnStretch)
+        writer.writeValue(m_attr_columnStretch);
+    if (m_has_attr_rowMinimumHeight)
+        writer.writeValue(m_attr_rowMinimumHeight);
+    if (m_has_attr_columnMinimumWidth)
+        writer.writeValue(m_attr_columnMinimumWidth);
+    writer.writeMask({!m_property.isEmpty(),
+                      !m_attribute.isEmpty(),
+                      !m_item.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_attribute.isEmpty())
+        writer.writeList(m_attribute);
+    if (!m_item.isEmpty())
+        writer.writeList(m_item);
+}
+
 void DomLayout::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -1738,25 +3240,24 @@ void DomLayoutItem::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"row"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Row:
             setAttributeRow(attribute.value().toInt());
             continue;
-        }
-        if (name == u"column"_s) {
+        case UiAttribute::Column:
             setAttributeColumn(attribute.value().toInt());
             continue;
-        }
-        if (name == u"rowspan"_s) {
+        case UiAttribute::Rowspan:
             setAttributeRowSpan(attribute.value().toInt());
             continue;
-        }
-        if (name == u"colspan"_s) {
+        case UiAttribute::Colspan:
             setAttributeColSpan(attribute.value().toInt());
             continue;
-        }
-        if (name == u"alignment"_s) {
+        case UiAttribute::Alignment:
             setAttributeAlignment(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1765,24 +3266,28 @@ void DomLayoutItem::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"widget"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Widget: {
                 auto *v = new DomWidget();
                 v->read(reader);
                 setElementWidget(v);
                 continue;
             }
-            if (!tag.compare(u"layout"_s, Qt::CaseInsensitive)) {
+            case UiElement::Layout: {
                 auto *v = new DomLayout();
                 v->read(reader);
                 setElementLayout(v);
                 continue;
             }
-            if (!tag.compare(u"spacer"_s, Qt::CaseInsensitive)) {
+            case UiElement::Spacer: {
                 auto *v = new DomSpacer();
                 v->read(reader);
                 setElementSpacer(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1835,6 +3340,76 @@ void DomLayoutItem::write(QXmlStreamWriter &writer, const QString &tagName) cons
     writer.writeEndElement();
 }
 
+void DomLayoutItem::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeRow(reader.readValue<int>());
+    if (attributes & (1u << 1))
+        setAttributeColumn(reader.readValue<int>());
+    if (attributes & (1u << 2))
+        setAttributeRowSpan(reader.readValue<int>());
+    if (attributes & (1u << 3))
+        setAttributeColSpan(reader.readValue<int>());
+    if (attributes & (1u << 4))
+        setAttributeAlignment(reader.readValue<QString>());
+    switch (reader.readValue<quint8>()) {
+    case Unknown:
+        break;
+    case Widget:
+        setElementWidget(reader.readNode<DomWidget>());
+        break;
+    case Layout:
+        setElementLayout(reader.readNode<DomLayout>());
+        break;
+    case Spacer:
+        setElementSpacer(reader.readNode<DomSpacer>());
+        break;
+    default:
+        reader.raiseError();
+        break;
+    }
+}
+
+void DomLayoutItem::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_row,
+                      m_has_attr_column,
+                      m_has_attr_rowSpan,
+                      m_has_attr_colSpan,
+                      m_has_attr_alignment});
+    if (m_has_attr_row)
+        writer.writeValue(m_attr_row);
+    if (m_has_attr_column)
+        writer.writeValue(m_attr_column);
+    if (m_has_attr_rowSpan)
+        writer.writeValue(m_attr_rowSpan);
+    if (m_has_attr_colSpan)
+        writer.writeValue(m_attr_colSpan);
+    if (m_has_attr_alignment)
+        writer.writeValue(m_attr_alignment);
+    switch (m_kind) {
+    case Widget:
+        writer.writeValue(quint8(m_widget != nullptr ? Widget : Unknown));
+        if (m_widget != nullptr)
+            m_widget->write(writer);
+        break;
+    case Layout:
+        writer.writeValue(quint8(m_layout != nullptr ? Layout : Unknown));
+        if (m_layout != nullptr)
+            m_layout->write(writer);
+        break;
+    case Spacer:
+        writer.writeValue(quint8(m_spacer != nullptr ? Spacer : Unknown));
+        if (m_spacer != nullptr)
+            m_spacer->write(writer);
+        break;
+    default:
+        writer.writeValue(quint8(Unknown));
+        break;
+    }
+}
+
 DomWidget *DomLayoutItem::takeElementWidget()
 {
     DomWidget *a = m_widget;
@@ -1889,12 +3464,16 @@ void DomRow::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1916,6 +3495,20 @@ void DomRow::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomRow::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+}
+
+void DomRow::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_property.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+}
+
 void DomRow::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -1934,12 +3527,16 @@ void DomColumn::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -1961,6 +3558,20 @@ void DomColumn::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomColumn::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+}
+
+void DomColumn::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_property.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+}
+
 void DomColumn::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -1980,13 +3591,15 @@ void DomItem::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"row"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Row:
             setAttributeRow(attribute.value().toInt());
             continue;
-        }
-        if (name == u"column"_s) {
+        case UiAttribute::Column:
             setAttributeColumn(attribute.value().toInt());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -1995,18 +3608,22 @@ void DomItem::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"item"_s, Qt::CaseInsensitive)) {
+            case UiElement::Item: {
                 auto *v = new DomItem();
                 v->read(reader);
                 m_item.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2037,6 +3654,36 @@ void DomItem::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomItem::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeRow(reader.readValue<int>());
+    if (attributes & (1u << 1))
+        setAttributeColumn(reader.readValue<int>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 1))
+        setElementItem(reader.readList<DomItem>());
+}
+
+void DomItem::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_row,
+                      m_has_attr_column});
+    if (m_has_attr_row)
+        writer.writeValue(m_attr_row);
+    if (m_has_attr_column)
+        writer.writeValue(m_attr_column);
+    writer.writeMask({!m_property.isEmpty(),
+                      !m_item.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_item.isEmpty())
+        writer.writeList(m_item);
+}
+
 void DomItem::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -2080,17 +3727,18 @@ void DomWidget::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"class"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Class:
             setAttributeClass(attribute.value().toString());
             continue;
-        }
-        if (name == u"name"_s) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
-        }
-        if (name == u"native"_s) {
+        case UiAttribute::Native:
             setAttributeNative(attribute.value() == u"true"_s);
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2099,83 +3747,83 @@ void DomWidget::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"class"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Class:
                 m_class.append(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
-            if (!tag.compare(u"script"_s, Qt::CaseInsensitive)) {
+            case UiElement::Script:
                 qWarning("Omitting deprecated element <script>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"widgetdata"_s, Qt::CaseInsensitive)) {
+            case UiElement::Widgetdata:
                 qWarning("Omitting deprecated element <widgetdata>.");
                 reader.skipCurrentElement();
                 continue;
-            }
-            if (!tag.compare(u"attribute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Attribute: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_attribute.append(v);
                 continue;
             }
-            if (!tag.compare(u"row"_s, Qt::CaseInsensitive)) {
+            case UiElement::Row: {
                 auto *v = new DomRow();
                 v->read(reader);
                 m_row.append(v);
                 continue;
             }
-            if (!tag.compare(u"column"_s, Qt::CaseInsensitive)) {
+            case UiElement::Column: {
                 auto *v = new DomColumn();
                 v->read(reader);
                 m_column.append(v);
                 continue;
             }
-            if (!tag.compare(u"item"_s, Qt::CaseInsensitive)) {
+            case UiElement::Item: {
                 auto *v = new DomItem();
                 v->read(reader);
                 m_item.append(v);
                 continue;
             }
-            if (!tag.compare(u"layout"_s, Qt::CaseInsensitive)) {
+            case UiElement::Layout: {
                 auto *v = new DomLayout();
                 v->read(reader);
                 m_layout.append(v);
                 continue;
             }
-            if (!tag.compare(u"widget"_s, Qt::CaseInsensitive)) {
+            case UiElement::Widget: {
                 auto *v = new DomWidget();
                 v->read(reader);
                 m_widget.append(v);
                 continue;
             }
-            if (!tag.compare(u"action"_s, Qt::CaseInsensitive)) {
+            case UiElement::Action: {
                 auto *v = new DomAction();
                 v->read(reader);
                 m_action.append(v);
                 continue;
             }
-            if (!tag.compare(u"actiongroup"_s, Qt::CaseInsensitive)) {
+            case UiElement::Actiongroup: {
                 auto *v = new DomActionGroup();
                 v->read(reader);
                 m_actionGroup.append(v);
                 continue;
             }
-            if (!tag.compare(u"addaction"_s, Qt::CaseInsensitive)) {
+            case UiElement::Addaction: {
                 auto *v = new DomActionRef();
                 v->read(reader);
                 m_addAction.append(v);
                 continue;
             }
-            if (!tag.compare(u"zorder"_s, Qt::CaseInsensitive)) {
+            case UiElement::Zorder:
                 m_zOrder.append(reader.readElementText());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -2240,6 +3888,91 @@ void DomWidget::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomWidget::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeClass(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeName(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeNative(reader.readValue<bool>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementClass(reader.readValue<QStringList>());
+    if (children & (1u << 1))
+        setElementProperty(reader.readList<DomProperty>());
+    if (children & (1u << 2))
+        setElementAttribute(reader.readList<DomProperty>());
+    if (children & (1u << 3))
+        setElementRow(reader.readList<DomRow>());
+    if (children & (1u << 4))
+        setElementColumn(reader.readList<DomColumn>());
+    if (children & (1u << 5))
+        setElementItem(reader.readList<DomItem>());
+    if (children & (1u << 6))
+        setElementLayout(reader.readList<DomLayout>());
+    if (children & (1u << 7))
+        setElementWidget(reader.readList<DomWidget>());
+    if (children & (1u << 8))
+        setElementAction(reader.readList<DomAction>());
+    if (children & (1u << 9))
+        setElementActionGroup(reader.readList<DomActionGroup>());
+    if (children & (1u << 10))
+        setElementAddAction(reader.readList<DomActionRef>());
+    if (children & (1u << 11))
+        setElementZOrder(reader.readValue<QStringList>());
+}
+
+void DomWidget::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_class,
+                      m_has_attr_name,
+                      m_has_attr_native});
+    if (m_has_attr_class)
+        writer.writeValue(m_attr_class);
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    if (m_has_attr_native)
+        writer.writeValue(m_attr_native);
+    writer.writeMask({!m_class.isEmpty(),
+                      !m_property.isEmpty(),
+                      !m_attribute.isEmpty(),
+                      !m_row.isEmpty(),
+                      !m_column.isEmpty(),
+                      !m_item.isEmpty(),
+                      !m_layout.isEmpty(),
+                      !m_widget.isEmpty(),
+                      !m_action.isEmpty(),
+                      !m_actionGroup.isEmpty(),
+                      !m_addAction.isEmpty(),
+                      !m_zOrder.isEmpty()});
+    if (!m_class.isEmpty())
+        writer.writeValue(m_class);
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+    if (!m_attribute.isEmpty())
+        writer.writeList(m_attribute);
+    if (!m_row.isEmpty())
+        writer.writeList(m_row);
+    if (!m_column.isEmpty())
+        writer.writeList(m_column);
+    if (!m_item.isEmpty())
+        writer.writeList(m_item);
+    if (!m_layout.isEmpty())
+        writer.writeList(m_layout);
+    if (!m_widget.isEmpty())
+        writer.writeList(m_widget);
+    if (!m_action.isEmpty())
+        writer.writeList(m_action);
+    if (!m_actionGroup.isEmpty())
+        writer.writeList(m_actionGroup);
+    if (!m_addAction.isEmpty())
+        writer.writeList(m_addAction);
+    if (!m_zOrder.isEmpty())
+        writer.writeValue(m_zOrder);
+}
+
 void DomWidget::setElementClass(const QStringList &a)
 {
     m_children |= Class;
@@ -2323,9 +4056,12 @@ void DomSpacer::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2334,12 +4070,16 @@ void DomSpacer::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2364,6 +4104,26 @@ void DomSpacer::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomSpacer::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+}
+
+void DomSpacer::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    writer.writeMask({!m_property.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+}
+
 void DomSpacer::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -2377,9 +4137,12 @@ void DomColor::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"alpha"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Alpha:
             setAttributeAlpha(attribute.value().toInt());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2388,17 +4151,18 @@ void DomColor::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"red"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Red:
                 setElementRed(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"green"_s, Qt::CaseInsensitive)) {
+            case UiElement::Green:
                 setElementGreen(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"blue"_s, Qt::CaseInsensitive)) {
+            case UiElement::Blue:
                 setElementBlue(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -2430,6 +4194,36 @@ void DomColor::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomColor::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeAlpha(reader.readValue<int>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementRed(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementGreen(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementBlue(reader.readValue<int>());
+}
+
+void DomColor::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_alpha});
+    if (m_has_attr_alpha)
+        writer.writeValue(m_attr_alpha);
+    writer.writeMask({hasElementRed(),
+                      hasElementGreen(),
+                      hasElementBlue()});
+    if (m_children & Red)
+        writer.writeValue(m_red);
+    if (m_children & Green)
+        writer.writeValue(m_green);
+    if (m_children & Blue)
+        writer.writeValue(m_blue);
+}
+
 void DomColor::setElementRed(int a)
 {
     m_children |= Red;
@@ -2473,9 +4267,12 @@ void DomGradientStop::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"position"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Position:
             setAttributePosition(attribute.value().toDouble());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2484,12 +4281,16 @@ void DomGradientStop::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"color"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Color: {
                 auto *v = new DomColor();
                 v->read(reader);
                 setElementColor(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2514,6 +4315,26 @@ void DomGradientStop::write(QXmlStreamWriter &writer, const QString &tagName) co
     writer.writeEndElement();
 }
 
+void DomGradientStop::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributePosition(reader.readValue<double>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementColor(reader.readNode<DomColor>());
+}
+
+void DomGradientStop::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_position});
+    if (m_has_attr_position)
+        writer.writeValue(m_attr_position);
+    writer.writeMask({hasElementColor()});
+    if (m_children & Color)
+        m_color->write(writer);
+}
+
 DomColor *DomGradientStop::takeElementColor()
 {
     DomColor *a = m_color;
@@ -2547,57 +4368,48 @@ void DomGradient::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"startx"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Startx:
             setAttributeStartX(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"starty"_s) {
+        case UiAttribute::Starty:
             setAttributeStartY(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"endx"_s) {
+        case UiAttribute::Endx:
             setAttributeEndX(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"endy"_s) {
+        case UiAttribute::Endy:
             setAttributeEndY(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"centralx"_s) {
+        case UiAttribute::Centralx:
             setAttributeCentralX(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"centraly"_s) {
+        case UiAttribute::Centraly:
             setAttributeCentralY(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"focalx"_s) {
+        case UiAttribute::Focalx:
             setAttributeFocalX(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"focaly"_s) {
+        case UiAttribute::Focaly:
             setAttributeFocalY(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"radius"_s) {
+        case UiAttribute::Radius:
             setAttributeRadius(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"angle"_s) {
+        case UiAttribute::Angle:
             setAttributeAngle(attribute.value().toDouble());
             continue;
-        }
-        if (name == u"type"_s) {
+        case UiAttribute::Type:
             setAttributeType(attribute.value().toString());
             continue;
-        }
-        if (name == u"spread"_s) {
+        case UiAttribute::Spread:
             setAttributeSpread(attribute.value().toString());
             continue;
-        }
-        if (name == u"coordinatemode"_s) {
+        case UiAttribute::Coordinatemode:
             setAttributeCoordinateMode(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2606,12 +4418,16 @@ void DomGradient::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"gradientstop"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Gradientstop: {
                 auto *v = new DomGradientStop();
                 v->read(reader);
                 m_gradientStop.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2672,6 +4488,86 @@ void DomGradient::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomGradient::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeStartX(reader.readValue<double>());
+    if (attributes & (1u << 1))
+        setAttributeStartY(reader.readValue<double>());
+    if (attributes & (1u << 2))
+        setAttributeEndX(reader.readValue<double>());
+    if (attributes & (1u << 3))
+        setAttributeEndY(reader.readValue<double>());
+    if (attributes & (1u << 4))
+        setAttributeCentralX(reader.readValue<double>());
+    if (attributes & (1u << 5))
+        setAttributeCentralY(reader.readValue<double>());
+    if (attributes & (1u << 6))
+        setAttributeFocalX(reader.readValue<double>());
+    if (attributes & (1u << 7))
+        setAttributeFocalY(reader.readValue<double>());
+    if (attributes & (1u << 8))
+        setAttributeRadius(reader.readValue<double>());
+    if (attributes & (1u << 9))
+        setAttributeAngle(reader.readValue<double>());
+    if (attributes & (1u << 10))
+        setAttributeType(reader.readValue<QString>());
+    if (attributes & (1u << 11))
+        setAttributeSpread(reader.readValue<QString>());
+    if (attributes & (1u << 12))
+        setAttributeCoordinateMode(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementGradientStop(reader.readList<DomGradientStop>());
+}
+
+void DomGradient::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_startX,
+                      m_has_attr_startY,
+                      m_has_attr_endX,
+                      m_has_attr_endY,
+                      m_has_attr_centralX,
+                      m_has_attr_centralY,
+                      m_has_attr_focalX,
+                      m_has_attr_focalY,
+                      m_has_attr_radius,
+                      m_has_attr_angle,
+                      m_has_attr_type,
+                      m_has_attr_spread,
+                      m_has_attr_coordinateMode});
+    if (m_has_attr_startX)
+        writer.writeValue(m_attr_startX);
+    if (m_has_attr_startY)
+        writer.writeValue(m_attr_startY);
+    if (m_has_attr_endX)
+        writer.writeValue(m_attr_endX);
+    if (m_has_attr_endY)
+        writer.writeValue(m_attr_endY);
+    if (m_has_attr_centralX)
+        writer.writeValue(m_attr_centralX);
+    if (m_has_attr_centralY)
+        writer.writeValue(m_attr_centralY);
+    if (m_has_attr_focalX)
+        writer.writeValue(m_attr_focalX);
+    if (m_has_attr_focalY)
+        writer.writeValue(m_attr_focalY);
+    if (m_has_attr_radius)
+        writer.writeValue(m_attr_radius);
+    if (m_has_attr_angle)
+        writer.writeValue(m_attr_angle);
+    if (m_has_attr_type)
+        writer.writeValue(m_attr_type);
+    if (m_has_attr_spread)
+        writer.writeValue(m_attr_spread);
+    if (m_has_attr_coordinateMode)
+        writer.writeValue(m_attr_coordinateMode);
+    writer.writeMask({!m_gradientStop.isEmpty()});
+    if (!m_gradientStop.isEmpty())
+        writer.writeList(m_gradientStop);
+}
+
 void DomGradient::setElementGradientStop(const QList<DomGradientStop *> &a)
 {
     m_children |= GradientStop;
@@ -2703,9 +4599,12 @@ void DomBrush::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"brushstyle"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Brushstyle:
             setAttributeBrushStyle(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2714,24 +4613,28 @@ void DomBrush::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"color"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Color: {
                 auto *v = new DomColor();
                 v->read(reader);
                 setElementColor(v);
                 continue;
             }
-            if (!tag.compare(u"texture"_s, Qt::CaseInsensitive)) {
+            case UiElement::Texture: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 setElementTexture(v);
                 continue;
             }
-            if (!tag.compare(u"gradient"_s, Qt::CaseInsensitive)) {
+            case UiElement::Gradient: {
                 auto *v = new DomGradient();
                 v->read(reader);
                 setElementGradient(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2772,6 +4675,56 @@ void DomBrush::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomBrush::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeBrushStyle(reader.readValue<QString>());
+    switch (reader.readValue<quint8>()) {
+    case Unknown:
+        break;
+    case Color:
+        setElementColor(reader.readNode<DomColor>());
+        break;
+    case Texture:
+        setElementTexture(reader.readNode<DomProperty>());
+        break;
+    case Gradient:
+        setElementGradient(reader.readNode<DomGradient>());
+        break;
+    default:
+        reader.raiseError();
+        break;
+    }
+}
+
+void DomBrush::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_brushStyle});
+    if (m_has_attr_brushStyle)
+        writer.writeValue(m_attr_brushStyle);
+    switch (m_kind) {
+    case Color:
+        writer.writeValue(quint8(m_color != nullptr ? Color : Unknown));
+        if (m_color != nullptr)
+            m_color->write(writer);
+        break;
+    case Texture:
+        writer.writeValue(quint8(m_texture != nullptr ? Texture : Unknown));
+        if (m_texture != nullptr)
+            m_texture->write(writer);
+        break;
+    case Gradient:
+        writer.writeValue(quint8(m_gradient != nullptr ? Gradient : Unknown));
+        if (m_gradient != nullptr)
+            m_gradient->write(writer);
+        break;
+    default:
+        writer.writeValue(quint8(Unknown));
+        break;
+    }
+}
+
 DomColor *DomBrush::takeElementColor()
 {
     DomColor *a = m_color;
@@ -2824,9 +4777,12 @@ void DomColorRole::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"role"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Role:
             setAttributeRole(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -2835,12 +4791,16 @@ void DomColorRole::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"brush"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Brush: {
                 auto *v = new DomBrush();
                 v->read(reader);
                 setElementBrush(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2865,6 +4825,26 @@ void DomColorRole::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomColorRole::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeRole(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementBrush(reader.readNode<DomBrush>());
+}
+
+void DomColorRole::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_role});
+    if (m_has_attr_role)
+        writer.writeValue(m_attr_role);
+    writer.writeMask({hasElementBrush()});
+    if (m_children & Brush)
+        m_brush->write(writer);
+}
+
 DomBrush *DomColorRole::takeElementBrush()
 {
     DomBrush *a = m_brush;
@@ -2901,18 +4881,22 @@ void DomColorGroup::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"colorrole"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Colorrole: {
                 auto *v = new DomColorRole();
                 v->read(reader);
                 m_colorRole.append(v);
                 continue;
             }
-            if (!tag.compare(u"color"_s, Qt::CaseInsensitive)) {
+            case UiElement::Color: {
                 auto *v = new DomColor();
                 v->read(reader);
                 m_color.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -2937,6 +4921,25 @@ void DomColorGroup::write(QXmlStreamWriter &writer, const QString &tagName) cons
     writer.writeEndElement();
 }
 
+void DomColorGroup::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementColorRole(reader.readList<DomColorRole>());
+    if (children & (1u << 1))
+        setElementColor(reader.readList<DomColor>());
+}
+
+void DomColorGroup::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_colorRole.isEmpty(),
+                      !m_color.isEmpty()});
+    if (!m_colorRole.isEmpty())
+        writer.writeList(m_colorRole);
+    if (!m_color.isEmpty())
+        writer.writeList(m_color);
+}
+
 void DomColorGroup::setElementColorRole(const QList<DomColorRole *> &a)
 {
     m_children |= ColorRole;
@@ -2962,24 +4965,28 @@ void DomPalette::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"active"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Active: {
                 auto *v = new DomColorGroup();
                 v->read(reader);
                 setElementActive(v);
                 continue;
             }
-            if (!tag.compare(u"inactive"_s, Qt::CaseInsensitive)) {
+            case UiElement::Inactive: {
                 auto *v = new DomColorGroup();
                 v->read(reader);
                 setElementInactive(v);
                 continue;
             }
-            if (!tag.compare(u"disabled"_s, Qt::CaseInsensitive)) {
+            case UiElement::Disabled: {
                 auto *v = new DomColorGroup();
                 v->read(reader);
                 setElementDisabled(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -3007,6 +5014,30 @@ void DomPalette::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomPalette::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementActive(reader.readNode<DomColorGroup>());
+    if (children & (1u << 1))
+        setElementInactive(reader.readNode<DomColorGroup>());
+    if (children & (1u << 2))
+        setElementDisabled(reader.readNode<DomColorGroup>());
+}
+
+void DomPalette::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementActive(),
+                      hasElementInactive(),
+                      hasElementDisabled()});
+    if (m_children & Active)
+        m_active->write(writer);
+    if (m_children & Inactive)
+        m_inactive->write(writer);
+    if (m_children & Disabled)
+        m_disabled->write(writer);
+}
+
 DomColorGroup *DomPalette::takeElementActive()
 {
     DomColorGroup *a = m_active;
@@ -3081,45 +5112,39 @@ void DomFont::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"family"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Family:
                 setElementFamily(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"pointsize"_s, Qt::CaseInsensitive)) {
+            case UiElement::Pointsize:
                 setElementPointSize(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"weight"_s, Qt::CaseInsensitive)) {
+            case UiElement::Weight:
                 setElementWeight(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"italic"_s, Qt::CaseInsensitive)) {
+            case UiElement::Italic:
                 setElementItalic(reader.readElementText() == u"true"_s);
                 continue;
-            }
-            if (!tag.compare(u"bold"_s, Qt::CaseInsensitive)) {
+            case UiElement::Bold:
                 setElementBold(reader.readElementText() == u"true"_s);
                 continue;
-            }
-            if (!tag.compare(u"underline"_s, Qt::CaseInsensitive)) {
+            case UiElement::Underline:
                 setElementUnderline(reader.readElementText() == u"true"_s);
                 continue;
-            }
-            if (!tag.compare(u"strikeout"_s, Qt::CaseInsensitive)) {
+            case UiElement::Strikeout:
                 setElementStrikeOut(reader.readElementText() == u"true"_s);
                 continue;
-            }
-            if (!tag.compare(u"antialiasing"_s, Qt::CaseInsensitive)) {
+            case UiElement::Antialiasing:
                 setElementAntialiasing(reader.readElementText() == u"true"_s);
                 continue;
-            }
-            if (!tag.compare(u"stylestrategy"_s, Qt::CaseInsensitive)) {
+            case UiElement::Stylestrategy:
                 setElementStyleStrategy(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"kerning"_s, Qt::CaseInsensitive)) {
+            case UiElement::Kerning:
                 setElementKerning(reader.readElementText() == u"true"_s);
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3169,6 +5194,65 @@ void DomFont::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomFont::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementFamily(reader.readValue<QString>());
+    if (children & (1u << 1))
+        setElementPointSize(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementWeight(reader.readValue<int>());
+    if (children & (1u << 3))
+        setElementItalic(reader.readValue<bool>());
+    if (children & (1u << 4))
+        setElementBold(reader.readValue<bool>());
+    if (children & (1u << 5))
+        setElementUnderline(reader.readValue<bool>());
+    if (children & (1u << 6))
+        setElementStrikeOut(reader.readValue<bool>());
+    if (children & (1u << 7))
+        setElementAntialiasing(reader.readValue<bool>());
+    if (children & (1u << 8))
+        setElementStyleStrategy(reader.readValue<QString>());
+    if (children & (1u << 9))
+        setElementKerning(reader.readValue<bool>());
+}
+
+void DomFont::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementFamily(),
+                      hasElementPointSize(),
+                      hasElementWeight(),
+                      hasElementItalic(),
+                      hasElementBold(),
+                      hasElementUnderline(),
+                      hasElementStrikeOut(),
+                      hasElementAntialiasing(),
+                      hasElementStyleStrategy(),
+                      hasElementKerning()});
+    if (m_children & Family)
+        writer.writeValue(m_family);
+    if (m_children & PointSize)
+        writer.writeValue(m_pointSize);
+    if (m_children & Weight)
+        writer.writeValue(m_weight);
+    if (m_children & Italic)
+        writer.writeValue(m_italic);
+    if (m_children & Bold)
+        writer.writeValue(m_bold);
+    if (m_children & Underline)
+        writer.writeValue(m_underline);
+    if (m_children & StrikeOut)
+        writer.writeValue(m_strikeOut);
+    if (m_children & Antialiasing)
+        writer.writeValue(m_antialiasing);
+    if (m_children & StyleStrategy)
+        writer.writeValue(m_styleStrategy);
+    if (m_children & Kerning)
+        writer.writeValue(m_kerning);
+}
+
 void DomFont::setElementFamily(const QString &a)
 {
     m_children |= Family;
@@ -3287,13 +5371,15 @@ void DomPoint::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"x"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::X:
                 setElementX(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"y"_s, Qt::CaseInsensitive)) {
+            case UiElement::Y:
                 setElementY(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3319,6 +5405,25 @@ void DomPoint::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomPoint::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementX(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementY(reader.readValue<int>());
+}
+
+void DomPoint::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementX(),
+                      hasElementY()});
+    if (m_children & X)
+        writer.writeValue(m_x);
+    if (m_children & Y)
+        writer.writeValue(m_y);
+}
+
 void DomPoint::setElementX(int a)
 {
     m_children |= X;
@@ -3349,21 +5454,21 @@ void DomRect::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"x"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::X:
                 setElementX(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"y"_s, Qt::CaseInsensitive)) {
+            case UiElement::Y:
                 setElementY(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"width"_s, Qt::CaseInsensitive)) {
+            case UiElement::Width:
                 setElementWidth(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"height"_s, Qt::CaseInsensitive)) {
+            case UiElement::Height:
                 setElementHeight(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3395,6 +5500,35 @@ void DomRect::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomRect::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementX(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementY(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementWidth(reader.readValue<int>());
+    if (children & (1u << 3))
+        setElementHeight(reader.readValue<int>());
+}
+
+void DomRect::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementX(),
+                      hasElementY(),
+                      hasElementWidth(),
+                      hasElementHeight()});
+    if (m_children & X)
+        writer.writeValue(m_x);
+    if (m_children & Y)
+        writer.writeValue(m_y);
+    if (m_children & Width)
+        writer.writeValue(m_width);
+    if (m_children & Height)
+        writer.writeValue(m_height);
+}
+
 void DomRect::setElementX(int a)
 {
     m_children |= X;
@@ -3446,13 +5580,15 @@ void DomLocale::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"language"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Language:
             setAttributeLanguage(attribute.value().toString());
             continue;
-        }
-        if (name == u"country"_s) {
+        case UiAttribute::Country:
             setAttributeCountry(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -3485,6 +5621,25 @@ void DomLocale::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomLocale::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeLanguage(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeCountry(reader.readValue<QString>());
+}
+
+void DomLocale::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_language,
+                      m_has_attr_country});
+    if (m_has_attr_language)
+        writer.writeValue(m_attr_language);
+    if (m_has_attr_country)
+        writer.writeValue(m_attr_country);
+}
+
 DomSizePolicy::~DomSizePolicy() = default;
 
 void DomSizePolicy::read(QXmlStreamReader &reader)
@@ -3492,13 +5647,15 @@ void DomSizePolicy::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"hsizetype"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Hsizetype:
             setAttributeHSizeType(attribute.value().toString());
             continue;
-        }
-        if (name == u"vsizetype"_s) {
+        case UiAttribute::Vsizetype:
             setAttributeVSizeType(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -3507,21 +5664,21 @@ void DomSizePolicy::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"hsizetype"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Hsizetype:
                 setElementHSizeType(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"vsizetype"_s, Qt::CaseInsensitive)) {
+            case UiElement::Vsizetype:
                 setElementVSizeType(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"horstretch"_s, Qt::CaseInsensitive)) {
+            case UiElement::Horstretch:
                 setElementHorStretch(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"verstretch"_s, Qt::CaseInsensitive)) {
+            case UiElement::Verstretch:
                 setElementVerStretch(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3559,6 +5716,46 @@ void DomSizePolicy::write(QXmlStreamWriter &writer, const QString &tagName) cons
     writer.writeEndElement();
 }
 
+void DomSizePolicy::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeHSizeType(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeVSizeType(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementHSizeType(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementVSizeType(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementHorStretch(reader.readValue<int>());
+    if (children & (1u << 3))
+        setElementVerStretch(reader.readValue<int>());
+}
+
+void DomSizePolicy::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_hSizeType,
+                      m_has_attr_vSizeType});
+    if (m_has_attr_hSizeType)
+        writer.writeValue(m_attr_hSizeType);
+    if (m_has_attr_vSizeType)
+        writer.writeValue(m_attr_vSizeType);
+    writer.writeMask({hasElementHSizeType(),
+                      hasElementVSizeType(),
+                      hasElementHorStretch(),
+                      hasElementVerStretch()});
+    if (m_children & HSizeType)
+        writer.writeValue(m_hSizeType);
+    if (m_children & VSizeType)
+        writer.writeValue(m_vSizeType);
+    if (m_children & HorStretch)
+        writer.writeValue(m_horStretch);
+    if (m_children & VerStretch)
+        writer.writeValue(m_verStretch);
+}
+
 void DomSizePolicy::setElementHSizeType(int a)
 {
     m_children |= HSizeType;
@@ -3611,13 +5808,15 @@ void DomSize::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"width"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Width:
                 setElementWidth(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"height"_s, Qt::CaseInsensitive)) {
+            case UiElement::Height:
                 setElementHeight(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3643,6 +5842,25 @@ void DomSize::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomSize::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementWidth(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementHeight(reader.readValue<int>());
+}
+
+void DomSize::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementWidth(),
+                      hasElementHeight()});
+    if (m_children & Width)
+        writer.writeValue(m_width);
+    if (m_children & Height)
+        writer.writeValue(m_height);
+}
+
 void DomSize::setElementWidth(int a)
 {
     m_children |= Width;
@@ -3673,17 +5891,18 @@ void DomDate::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"year"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Year:
                 setElementYear(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"month"_s, Qt::CaseInsensitive)) {
+            case UiElement::Month:
                 setElementMonth(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"day"_s, Qt::CaseInsensitive)) {
+            case UiElement::Day:
                 setElementDay(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3712,6 +5931,30 @@ void DomDate::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomDate::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementYear(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementMonth(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementDay(reader.readValue<int>());
+}
+
+void DomDate::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementYear(),
+                      hasElementMonth(),
+                      hasElementDay()});
+    if (m_children & Year)
+        writer.writeValue(m_year);
+    if (m_children & Month)
+        writer.writeValue(m_month);
+    if (m_children & Day)
+        writer.writeValue(m_day);
+}
+
 void DomDate::setElementYear(int a)
 {
     m_children |= Year;
@@ -3753,17 +5996,18 @@ void DomTime::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"hour"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Hour:
                 setElementHour(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"minute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Minute:
                 setElementMinute(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"second"_s, Qt::CaseInsensitive)) {
+            case UiElement::Second:
                 setElementSecond(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3792,6 +6036,30 @@ void DomTime::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomTime::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementHour(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementMinute(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementSecond(reader.readValue<int>());
+}
+
+void DomTime::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementHour(),
+                      hasElementMinute(),
+                      hasElementSecond()});
+    if (m_children & Hour)
+        writer.writeValue(m_hour);
+    if (m_children & Minute)
+        writer.writeValue(m_minute);
+    if (m_children & Second)
+        writer.writeValue(m_second);
+}
+
 void DomTime::setElementHour(int a)
 {
     m_children |= Hour;
@@ -3833,29 +6101,27 @@ void DomDateTime::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"hour"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Hour:
                 setElementHour(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"minute"_s, Qt::CaseInsensitive)) {
+            case UiElement::Minute:
                 setElementMinute(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"second"_s, Qt::CaseInsensitive)) {
+            case UiElement::Second:
                 setElementSecond(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"year"_s, Qt::CaseInsensitive)) {
+            case UiElement::Year:
                 setElementYear(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"month"_s, Qt::CaseInsensitive)) {
+            case UiElement::Month:
                 setElementMonth(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"day"_s, Qt::CaseInsensitive)) {
+            case UiElement::Day:
                 setElementDay(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -3893,6 +6159,45 @@ void DomDateTime::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomDateTime::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementHour(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementMinute(reader.readValue<int>());
+    if (children & (1u << 2))
+        setElementSecond(reader.readValue<int>());
+    if (children & (1u << 3))
+        setElementYear(reader.readValue<int>());
+    if (children & (1u << 4))
+        setElementMonth(reader.readValue<int>());
+    if (children & (1u << 5))
+        setElementDay(reader.readValue<int>());
+}
+
+void DomDateTime::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementHour(),
+                      hasElementMinute(),
+                      hasElementSecond(),
+                      hasElementYear(),
+                      hasElementMonth(),
+                      hasElementDay()});
+    if (m_children & Hour)
+        writer.writeValue(m_hour);
+    if (m_children & Minute)
+        writer.writeValue(m_minute);
+    if (m_children & Second)
+        writer.writeValue(m_second);
+    if (m_children & Year)
+        writer.writeValue(m_year);
+    if (m_children & Month)
+        writer.writeValue(m_month);
+    if (m_children & Day)
+        writer.writeValue(m_day);
+}
+
 void DomDateTime::setElementHour(int a)
 {
     m_children |= Hour;
@@ -3969,21 +6274,21 @@ void DomStringList::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"notr"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Notr:
             setAttributeNotr(attribute.value().toString());
             continue;
-        }
-        if (name == u"comment"_s) {
+        case UiAttribute::Comment:
             setAttributeComment(attribute.value().toString());
             continue;
-        }
-        if (name == u"extracomment"_s) {
+        case UiAttribute::Extracomment:
             setAttributeExtraComment(attribute.value().toString());
             continue;
-        }
-        if (name == u"id"_s) {
+        case UiAttribute::Id:
             setAttributeId(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -3992,9 +6297,12 @@ void DomStringList::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"string"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::String:
                 m_string.append(reader.readElementText());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -4029,6 +6337,41 @@ void DomStringList::write(QXmlStreamWriter &writer, const QString &tagName) cons
     writer.writeEndElement();
 }
 
+void DomStringList::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeNotr(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeComment(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeExtraComment(reader.readValue<QString>());
+    if (attributes & (1u << 3))
+        setAttributeId(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementString(reader.readValue<QStringList>());
+}
+
+void DomStringList::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_notr,
+                      m_has_attr_comment,
+                      m_has_attr_extraComment,
+                      m_has_attr_id});
+    if (m_has_attr_notr)
+        writer.writeValue(m_attr_notr);
+    if (m_has_attr_comment)
+        writer.writeValue(m_attr_comment);
+    if (m_has_attr_extraComment)
+        writer.writeValue(m_attr_extraComment);
+    if (m_has_attr_id)
+        writer.writeValue(m_attr_id);
+    writer.writeMask({!m_string.isEmpty()});
+    if (!m_string.isEmpty())
+        writer.writeValue(m_string);
+}
+
 void DomStringList::setElementString(const QStringList &a)
 {
     m_children |= String;
@@ -4042,13 +6385,15 @@ void DomResourcePixmap::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"resource"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Resource:
             setAttributeResource(attribute.value().toString());
             continue;
-        }
-        if (name == u"alias"_s) {
+        case UiAttribute::Alias:
             setAttributeAlias(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -4088,6 +6433,27 @@ void DomResourcePixmap::write(QXmlStreamWriter &writer, const QString &tagName)
     writer.writeEndElement();
 }
 
+void DomResourcePixmap::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeResource(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeAlias(reader.readValue<QString>());
+    m_text = reader.readValue<QString>();
+}
+
+void DomResourcePixmap::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_resource,
+                      m_has_attr_alias});
+    if (m_has_attr_resource)
+        writer.writeValue(m_attr_resource);
+    if (m_has_attr_alias)
+        writer.writeValue(m_attr_alias);
+    writer.writeValue(m_text);
+}
+
 DomResourceIcon::~DomResourceIcon()
 {
     delete m_normalOff;
@@ -4105,13 +6471,15 @@ void DomResourceIcon::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"theme"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Theme:
             setAttributeTheme(attribute.value().toString());
             continue;
-        }
-        if (name == u"resource"_s) {
+        case UiAttribute::Resource:
             setAttributeResource(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -4120,54 +6488,58 @@ void DomResourceIcon::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"normaloff"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Normaloff: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementNormalOff(v);
                 continue;
             }
-            if (!tag.compare(u"normalon"_s, Qt::CaseInsensitive)) {
+            case UiElement::Normalon: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementNormalOn(v);
                 continue;
             }
-            if (!tag.compare(u"disabledoff"_s, Qt::CaseInsensitive)) {
+            case UiElement::Disabledoff: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementDisabledOff(v);
                 continue;
             }
-            if (!tag.compare(u"disabledon"_s, Qt::CaseInsensitive)) {
+            case UiElement::Disabledon: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementDisabledOn(v);
                 continue;
             }
-            if (!tag.compare(u"activeoff"_s, Qt::CaseInsensitive)) {
+            case UiElement::Activeoff: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementActiveOff(v);
                 continue;
             }
-            if (!tag.compare(u"activeon"_s, Qt::CaseInsensitive)) {
+            case UiElement::Activeon: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementActiveOn(v);
                 continue;
             }
-            if (!tag.compare(u"selectedoff"_s, Qt::CaseInsensitive)) {
+            case UiElement::Selectedoff: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementSelectedOff(v);
                 continue;
             }
-            if (!tag.compare(u"selectedon"_s, Qt::CaseInsensitive)) {
+            case UiElement::Selectedon: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementSelectedOn(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -4223,6 +6595,68 @@ void DomResourceIcon::write(QXmlStreamWriter &writer, const QString &tagName) co
     writer.writeEndElement();
 }
 
+void DomResourceIcon::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeTheme(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeResource(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementNormalOff(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 1))
+        setElementNormalOn(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 2))
+        setElementDisabledOff(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 3))
+        setElementDisabledOn(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 4))
+        setElementActiveOff(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 5))
+        setElementActiveOn(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 6))
+        setElementSelectedOff(reader.readNode<DomResourcePixmap>());
+    if (children & (1u << 7))
+        setElementSelectedOn(reader.readNode<DomResourcePixmap>());
+    m_text = reader.readValue<QString>();
+}
+
+void DomResourceIcon::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_theme,
+                      m_has_attr_resource});
+    if (m_has_attr_theme)
+        writer.writeValue(m_attr_theme);
+    if (m_has_attr_resource)
+        writer.writeValue(m_attr_resource);
+    writer.writeMask({hasElementNormalOff(),
+                      hasElementNormalOn(),
+                      hasElementDisabledOff(),
+                      hasElementDisabledOn(),
+                      hasElementActiveOff(),
+                      hasElementActiveOn(),
+                      hasElementSelectedOff(),
+                      hasElementSelectedOn()});
+    if (m_children & NormalOff)
+        m_normalOff->write(writer);
+    if (m_children & NormalOn)
+        m_normalOn->write(writer);
+    if (m_children & DisabledOff)
+        m_disabledOff->write(writer);
+    if (m_children & DisabledOn)
+        m_disabledOn->write(writer);
+    if (m_children & ActiveOff)
+        m_activeOff->write(writer);
+    if (m_children & ActiveOn)
+        m_activeOn->write(writer);
+    if (m_children & SelectedOff)
+        m_selectedOff->write(writer);
+    if (m_children & SelectedOn)
+        m_selectedOn->write(writer);
+    writer.writeValue(m_text);
+}
+
 DomResourcePixmap *DomResourceIcon::takeElementNormalOff()
 {
     DomResourcePixmap *a = m_normalOff;
@@ -4406,21 +6840,21 @@ void DomString::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"notr"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Notr:
             setAttributeNotr(attribute.value().toString());
             continue;
-        }
-        if (name == u"comment"_s) {
+        case UiAttribute::Comment:
             setAttributeComment(attribute.value().toString());
             continue;
-        }
-        if (name == u"extracomment"_s) {
+        case UiAttribute::Extracomment:
             setAttributeExtraComment(attribute.value().toString());
             continue;
-        }
-        if (name == u"id"_s) {
+        case UiAttribute::Id:
             setAttributeId(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -4466,6 +6900,37 @@ void DomString::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomString::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeNotr(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeComment(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeExtraComment(reader.readValue<QString>());
+    if (attributes & (1u << 3))
+        setAttributeId(reader.readValue<QString>());
+    m_text = reader.readValue<QString>();
+}
+
+void DomString::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_notr,
+                      m_has_attr_comment,
+                      m_has_attr_extraComment,
+                      m_has_attr_id});
+    if (m_has_attr_notr)
+        writer.writeValue(m_attr_notr);
+    if (m_has_attr_comment)
+        writer.writeValue(m_attr_comment);
+    if (m_has_attr_extraComment)
+        writer.writeValue(m_attr_extraComment);
+    if (m_has_attr_id)
+        writer.writeValue(m_attr_id);
+    writer.writeValue(m_text);
+}
+
 DomPointF::~DomPointF() = default;
 
 void DomPointF::read(QXmlStreamReader &reader)
@@ -4474,13 +6939,15 @@ void DomPointF::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"x"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::X:
                 setElementX(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"y"_s, Qt::CaseInsensitive)) {
+            case UiElement::Y:
                 setElementY(reader.readElementText().toDouble());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -4506,6 +6973,25 @@ void DomPointF::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomPointF::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementX(reader.readValue<double>());
+    if (children & (1u << 1))
+        setElementY(reader.readValue<double>());
+}
+
+void DomPointF::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementX(),
+                      hasElementY()});
+    if (m_children & X)
+        writer.writeValue(m_x);
+    if (m_children & Y)
+        writer.writeValue(m_y);
+}
+
 void DomPointF::setElementX(double a)
 {
     m_children |= X;
@@ -4536,21 +7022,21 @@ void DomRectF::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"x"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::X:
                 setElementX(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"y"_s, Qt::CaseInsensitive)) {
+            case UiElement::Y:
                 setElementY(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"width"_s, Qt::CaseInsensitive)) {
+            case UiElement::Width:
                 setElementWidth(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"height"_s, Qt::CaseInsensitive)) {
+            case UiElement::Height:
                 setElementHeight(reader.readElementText().toDouble());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -4582,6 +7068,35 @@ void DomRectF::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomRectF::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementX(reader.readValue<double>());
+    if (children & (1u << 1))
+        setElementY(reader.readValue<double>());
+    if (children & (1u << 2))
+        setElementWidth(reader.readValue<double>());
+    if (children & (1u << 3))
+        setElementHeight(reader.readValue<double>());
+}
+
+void DomRectF::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementX(),
+                      hasElementY(),
+                      hasElementWidth(),
+                      hasElementHeight()});
+    if (m_children & X)
+        writer.writeValue(m_x);
+    if (m_children & Y)
+        writer.writeValue(m_y);
+    if (m_children & Width)
+        writer.writeValue(m_width);
+    if (m_children & Height)
+        writer.writeValue(m_height);
+}
+
 void DomRectF::setElementX(double a)
 {
     m_children |= X;
@@ -4634,13 +7149,15 @@ void DomSizeF::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"width"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Width:
                 setElementWidth(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"height"_s, Qt::CaseInsensitive)) {
+            case UiElement::Height:
                 setElementHeight(reader.readElementText().toDouble());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -4666,6 +7183,25 @@ void DomSizeF::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomSizeF::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementWidth(reader.readValue<double>());
+    if (children & (1u << 1))
+        setElementHeight(reader.readValue<double>());
+}
+
+void DomSizeF::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementWidth(),
+                      hasElementHeight()});
+    if (m_children & Width)
+        writer.writeValue(m_width);
+    if (m_children & Height)
+        writer.writeValue(m_height);
+}
+
 void DomSizeF::setElementWidth(double a)
 {
     m_children |= Width;
@@ -4696,9 +7232,12 @@ void DomChar::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"unicode"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Unicode:
                 setElementUnicode(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -4721,6 +7260,20 @@ void DomChar::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomChar::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementUnicode(reader.readValue<int>());
+}
+
+void DomChar::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementUnicode()});
+    if (m_children & Unicode)
+        writer.writeValue(m_unicode);
+}
+
 void DomChar::setElementUnicode(int a)
 {
     m_children |= Unicode;
@@ -4743,12 +7296,16 @@ void DomUrl::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"string"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::String: {
                 auto *v = new DomString();
                 v->read(reader);
                 setElementString(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -4770,6 +7327,20 @@ void DomUrl::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomUrl::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementString(reader.readNode<DomString>());
+}
+
+void DomUrl::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementString()});
+    if (m_children & String)
+        m_string->write(writer);
+}
+
 DomString *DomUrl::takeElementString()
 {
     DomString *a = m_string;
@@ -4878,13 +7449,15 @@ void DomProperty::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
-        }
-        if (name == u"stdset"_s) {
+        case UiAttribute::Stdset:
             setAttributeStdset(attribute.value().toInt());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -4893,180 +7466,172 @@ void DomProperty::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"bool"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Bool:
                 setElementBool(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"color"_s, Qt::CaseInsensitive)) {
+            case UiElement::Color: {
                 auto *v = new DomColor();
                 v->read(reader);
                 setElementColor(v);
                 continue;
             }
-            if (!tag.compare(u"cstring"_s, Qt::CaseInsensitive)) {
+            case UiElement::Cstring:
                 setElementCstring(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"cursor"_s, Qt::CaseInsensitive)) {
+            case UiElement::Cursor:
                 setElementCursor(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"cursorshape"_s, Qt::CaseInsensitive)) {
+            case UiElement::Cursorshape:
                 setElementCursorShape(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"enum"_s, Qt::CaseInsensitive)) {
+            case UiElement::Enum:
                 setElementEnum(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"font"_s, Qt::CaseInsensitive)) {
+            case UiElement::Font: {
                 auto *v = new DomFont();
                 v->read(reader);
                 setElementFont(v);
                 continue;
             }
-            if (!tag.compare(u"iconset"_s, Qt::CaseInsensitive)) {
+            case UiElement::Iconset: {
                 auto *v = new DomResourceIcon();
                 v->read(reader);
                 setElementIconSet(v);
                 continue;
             }
-            if (!tag.compare(u"pixmap"_s, Qt::CaseInsensitive)) {
+            case UiElement::Pixmap: {
                 auto *v = new DomResourcePixmap();
                 v->read(reader);
                 setElementPixmap(v);
                 continue;
             }
-            if (!tag.compare(u"palette"_s, Qt::CaseInsensitive)) {
+            case UiElement::Palette: {
                 auto *v = new DomPalette();
                 v->read(reader);
                 setElementPalette(v);
                 continue;
             }
-            if (!tag.compare(u"point"_s, Qt::CaseInsensitive)) {
+            case UiElement::Point: {
                 auto *v = new DomPoint();
                 v->read(reader);
                 setElementPoint(v);
                 continue;
             }
-            if (!tag.compare(u"rect"_s, Qt::CaseInsensitive)) {
+            case UiElement::Rect: {
                 auto *v = new DomRect();
                 v->read(reader);
                 setElementRect(v);
                 continue;
             }
-            if (!tag.compare(u"set"_s, Qt::CaseInsensitive)) {
+            case UiElement::Set:
                 setElementSet(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"locale"_s, Qt::CaseInsensitive)) {
+            case UiElement::Locale: {
                 auto *v = new DomLocale();
                 v->read(reader);
                 setElementLocale(v);
                 continue;
             }
-            if (!tag.compare(u"sizepolicy"_s, Qt::CaseInsensitive)) {
+            case UiElement::Sizepolicy: {
                 auto *v = new DomSizePolicy();
                 v->read(reader);
                 setElementSizePolicy(v);
                 continue;
             }
-            if (!tag.compare(u"size"_s, Qt::CaseInsensitive)) {
+            case UiElement::Size: {
                 auto *v = new DomSize();
                 v->read(reader);
                 setElementSize(v);
                 continue;
             }
-            if (!tag.compare(u"string"_s, Qt::CaseInsensitive)) {
+            case UiElement::String: {
                 auto *v = new DomString();
                 v->read(reader);
                 setElementString(v);
                 continue;
             }
-            if (!tag.compare(u"stringlist"_s, Qt::CaseInsensitive)) {
+            case UiElement::Stringlist: {
                 auto *v = new DomStringList();
                 v->read(reader);
                 setElementStringList(v);
                 continue;
             }
-            if (!tag.compare(u"number"_s, Qt::CaseInsensitive)) {
+            case UiElement::Number:
                 setElementNumber(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"float"_s, Qt::CaseInsensitive)) {
+            case UiElement::Float:
                 setElementFloat(reader.readElementText().toFloat());
                 continue;
-            }
-            if (!tag.compare(u"double"_s, Qt::CaseInsensitive)) {
+            case UiElement::Double:
                 setElementDouble(reader.readElementText().toDouble());
                 continue;
-            }
-            if (!tag.compare(u"date"_s, Qt::CaseInsensitive)) {
+            case UiElement::Date: {
                 auto *v = new DomDate();
                 v->read(reader);
                 setElementDate(v);
                 continue;
             }
-            if (!tag.compare(u"time"_s, Qt::CaseInsensitive)) {
+            case UiElement::Time: {
                 auto *v = new DomTime();
                 v->read(reader);
                 setElementTime(v);
                 continue;
             }
-            if (!tag.compare(u"datetime"_s, Qt::CaseInsensitive)) {
+            case UiElement::Datetime: {
                 auto *v = new DomDateTime();
                 v->read(reader);
                 setElementDateTime(v);
                 continue;
             }
-            if (!tag.compare(u"pointf"_s, Qt::CaseInsensitive)) {
+            case UiElement::Pointf: {
                 auto *v = new DomPointF();
                 v->read(reader);
                 setElementPointF(v);
                 continue;
             }
-            if (!tag.compare(u"rectf"_s, Qt::CaseInsensitive)) {
+            case UiElement::Rectf: {
                 auto *v = new DomRectF();
                 v->read(reader);
                 setElementRectF(v);
                 continue;
             }
-            if (!tag.compare(u"sizef"_s, Qt::CaseInsensitive)) {
+            case UiElement::Sizef: {
                 auto *v = new DomSizeF();
                 v->read(reader);
                 setElementSizeF(v);
                 continue;
             }
-            if (!tag.compare(u"longlong"_s, Qt::CaseInsensitive)) {
+            case UiElement::Longlong:
                 setElementLongLong(reader.readElementText().toLongLong());
                 continue;
-            }
-            if (!tag.compare(u"char"_s, Qt::CaseInsensitive)) {
+            case UiElement::Char: {
                 auto *v = new DomChar();
                 v->read(reader);
                 setElementChar(v);
                 continue;
             }
-            if (!tag.compare(u"url"_s, Qt::CaseInsensitive)) {
+            case UiElement::Url: {
                 auto *v = new DomUrl();
                 v->read(reader);
                 setElementUrl(v);
                 continue;
             }
-            if (!tag.compare(u"uint"_s, Qt::CaseInsensitive)) {
+            case UiElement::Uint:
                 setElementUInt(reader.readElementText().toUInt());
                 continue;
-            }
-            if (!tag.compare(u"ulonglong"_s, Qt::CaseInsensitive)) {
+            case UiElement::Ulonglong:
                 setElementULongLong(reader.readElementText().toULongLong());
                 continue;
-            }
-            if (!tag.compare(u"brush"_s, Qt::CaseInsensitive)) {
+            case UiElement::Brush: {
                 auto *v = new DomBrush();
                 v->read(reader);
                 setElementBrush(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -5248,6 +7813,289 @@ void DomProperty::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomProperty::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeStdset(reader.readValue<int>());
+    switch (reader.readValue<quint8>()) {
+    case Unknown:
+        break;
+    case Bool:
+        setElementBool(reader.readValue<QString>());
+        break;
+    case Color:
+        setElementColor(reader.readNode<DomColor>());
+        break;
+    case Cstring:
+        setElementCstring(reader.readValue<QString>());
+        break;
+    case Cursor:
+        setElementCursor(reader.readValue<int>());
+        break;
+    case CursorShape:
+        setElementCursorShape(reader.readValue<QString>());
+        break;
+    case Enum:
+        setElementEnum(reader.readValue<QString>());
+        break;
+    case Font:
+        setElementFont(reader.readNode<DomFont>());
+        break;
+    case IconSet:
+        setElementIconSet(reader.readNode<DomResourceIcon>());
+        break;
+    case Pixmap:
+        setElementPixmap(reader.readNode<DomResourcePixmap>());
+        break;
+    case Palette:
+        setElementPalette(reader.readNode<DomPalette>());
+        break;
+    case Point:
+        setElementPoint(reader.readNode<DomPoint>());
+        break;
+    case Rect:
+        setElementRect(reader.readNode<DomRect>());
+        break;
+    case Set:
+        setElementSet(reader.readValue<QString>());
+        break;
+    case Locale:
+        setElementLocale(reader.readNode<DomLocale>());
+        break;
+    case SizePolicy:
+        setElementSizePolicy(reader.readNode<DomSizePolicy>());
+        break;
+    case Size:
+        setElementSize(reader.readNode<DomSize>());
+        break;
+    case String:
+        setElementString(reader.readNode<DomString>());
+        break;
+    case StringList:
+        setElementStringList(reader.readNode<DomStringList>());
+        break;
+    case Number:
+        setElementNumber(reader.readValue<int>());
+        break;
+    case Float:
+        setElementFloat(reader.readValue<float>());
+        break;
+    case Double:
+        setElementDouble(reader.readValue<double>());
+        break;
+    case Date:
+        setElementDate(reader.readNode<DomDate>());
+        break;
+    case Time:
+        setElementTime(reader.readNode<DomTime>());
+        break;
+    case DateTime:
+        setElementDateTime(reader.readNode<DomDateTime>());
+        break;
+    case PointF:
+        setElementPointF(reader.readNode<DomPointF>());
+        break;
+    case RectF:
+        setElementRectF(reader.readNode<DomRectF>());
+        break;
+    case SizeF:
+        setElementSizeF(reader.readNode<DomSizeF>());
+        break;
+    case LongLong:
+        setElementLongLong(reader.readValue<qlonglong>());
+        break;
+    case Char:
+        setElementChar(reader.readNode<DomChar>());
+        break;
+    case Url:
+        setElementUrl(reader.readNode<DomUrl>());
+        break;
+    case UInt:
+        setElementUInt(reader.readValue<uint>());
+        break;
+    case ULongLong:
+        setElementULongLong(reader.readValue<qulonglong>());
+        break;
+    case Brush:
+        setElementBrush(reader.readNode<DomBrush>());
+        break;
+    default:
+        reader.raiseError();
+        break;
+    }
+}
+
+void DomProperty::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name,
+                      m_has_attr_stdset});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    if (m_has_attr_stdset)
+        writer.writeValue(m_attr_stdset);
+    switch (m_kind) {
+    case Bool:
+        writer.writeValue(quint8(Bool));
+        writer.writeValue(m_bool);
+        break;
+    case Color:
+        writer.writeValue(quint8(m_color != nullptr ? Color : Unknown));
+        if (m_color != nullptr)
+            m_color->write(writer);
+        break;
+    case Cstring:
+        writer.writeValue(quint8(Cstring));
+        writer.writeValue(m_cstring);
+        break;
+    case Cursor:
+        writer.writeValue(quint8(Cursor));
+        writer.writeValue(m_cursor);
+        break;
+    case CursorShape:
+        writer.writeValue(quint8(CursorShape));
+        writer.writeValue(m_cursorShape);
+        break;
+    case Enum:
+        writer.writeValue(quint8(Enum));
+        writer.writeValue(m_enum);
+        break;
+    case Font:
+        writer.writeValue(quint8(m_font != nullptr ? Font : Unknown));
+        if (m_font != nullptr)
+            m_font->write(writer);
+        break;
+    case IconSet:
+        writer.writeValue(quint8(m_iconSet != nullptr ? IconSet : Unknown));
+        if (m_iconSet != nullptr)
+            m_iconSet->write(writer);
+        break;
+    case Pixmap:
+        writer.writeValue(quint8(m_pixmap != nullptr ? Pixmap : Unknown));
+        if (m_pixmap != nullptr)
+            m_pixmap->write(writer);
+        break;
+    case Palette:
+        writer.writeValue(quint8(m_palette != nullptr ? Palette : Unknown));
+        if (m_palette != nullptr)
+            m_palette->write(writer);
+        break;
+    case Point:
+        writer.writeValue(quint8(m_point != nullptr ? Point : Unknown));
+        if (m_point != nullptr)
+            m_point->write(writer);
+        break;
+    case Rect:
+        writer.writeValue(quint8(m_rect != nullptr ? Rect : Unknown));
+        if (m_rect != nullptr)
+            m_rect->write(writer);
+        break;
+    case Set:
+        writer.writeValue(quint8(Set));
+        writer.writeValue(m_set);
+        break;
+    case Locale:
+        writer.writeValue(quint8(m_locale != nullptr ? Locale : Unknown));
+        if (m_locale != nullptr)
+            m_locale->write(writer);
+        break;
+    case SizePolicy:
+        writer.writeValue(quint8(m_sizePolicy != nullptr ? SizePolicy : Unknown));
+        if (m_sizePolicy != nullptr)
+            m_sizePolicy->write(writer);
+        break;
+    case Size:
+        writer.writeValue(quint8(m_size != nullptr ? Size : Unknown));
+        if (m_size != nullptr)
+            m_size->write(writer);
+        break;
+    case String:
+        writer.writeValue(quint8(m_string != nullptr ? String : Unknown));
+        if (m_string != nullptr)
+            m_string->write(writer);
+        break;
+    case StringList:
+        writer.writeValue(quint8(m_stringList != nullptr ? StringList : Unknown));
+        if (m_stringList != nullptr)
+            m_stringList->write(writer);
+        break;
+    case Number:
+        writer.writeValue(quint8(Number));
+        writer.writeValue(m_number);
+        break;
+    case Float:
+        writer.writeValue(quint8(Float));
+        writer.writeValue(m_float);
+        break;
+    case Double:
+        writer.writeValue(quint8(Double));
+        writer.writeValue(m_double);
+        break;
+    case Date:
+        writer.writeValue(quint8(m_date != nullptr ? Date : Unknown));
+        if (m_date != nullptr)
+            m_date->write(writer);
+        break;
+    case Time:
+        writer.writeValue(quint8(m_time != nullptr ? Time : Unknown));
+        if (m_time != nullptr)
+            m_time->write(writer);
+        break;
+    case DateTime:
+        writer.writeValue(quint8(m_dateTime != nullptr ? DateTime : Unknown));
+        if (m_dateTime != nullptr)
+            m_dateTime->write(writer);
+        break;
+    case PointF:
+        writer.writeValue(quint8(m_pointF != nullptr ? PointF : Unknown));
+        if (m_pointF != nullptr)
+            m_pointF->write(writer);
+        break;
+    case RectF:
+        writer.writeValue(quint8(m_rectF != nullptr ? RectF : Unknown));
+        if (m_rectF != nullptr)
+            m_rectF->write(writer);
+        break;
+    case SizeF:
+        writer.writeValue(quint8(m_sizeF != nullptr ? SizeF : Unknown));
+        if (m_sizeF != nullptr)
+            m_sizeF->write(writer);
+        break;
+    case LongLong:
+        writer.writeValue(quint8(LongLong));
+        writer.writeValue(m_longLong);
+        break;
+    case Char:
+        writer.writeValue(quint8(m_char != nullptr ? Char : Unknown));
+        if (m_char != nullptr)
+            m_char->write(writer);
+        break;
+    case Url:
+        writer.writeValue(quint8(m_url != nullptr ? Url : Unknown));
+        if (m_url != nullptr)
+            m_url->write(writer);
+        break;
+    case UInt:
+        writer.writeValue(quint8(UInt));
+        writer.writeValue(m_UInt);
+        break;
+    case ULongLong:
+        writer.writeValue(quint8(ULongLong));
+        writer.writeValue(m_uLongLong);
+        break;
+    case Brush:
+        writer.writeValue(quint8(m_brush != nullptr ? Brush : Unknown));
+        if (m_brush != nullptr)
+            m_brush->write(writer);
+        break;
+    default:
+        writer.writeValue(quint8(Unknown));
+        break;
+    }
+}
+
 void DomProperty::setElementBool(const QString &a)
 {
     clear();
@@ -5638,12 +8486,16 @@ void DomConnections::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"connection"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Connection: {
                 auto *v = new DomConnection();
                 v->read(reader);
                 m_connection.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -5665,6 +8517,20 @@ void DomConnections::write(QXmlStreamWriter &writer, const QString &tagName) con
     writer.writeEndElement();
 }
 
+void DomConnections::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementConnection(reader.readList<DomConnection>());
+}
+
+void DomConnections::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_connection.isEmpty()});
+    if (!m_connection.isEmpty())
+        writer.writeList(m_connection);
+}
+
 void DomConnections::setElementConnection(const QList<DomConnection *> &a)
 {
     m_children |= Connection;
@@ -5682,28 +8548,28 @@ void DomConnection::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"sender"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Sender:
                 setElementSender(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"signal"_s, Qt::CaseInsensitive)) {
+            case UiElement::Signal:
                 setElementSignal(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"receiver"_s, Qt::CaseInsensitive)) {
+            case UiElement::Receiver:
                 setElementReceiver(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"slot"_s, Qt::CaseInsensitive)) {
+            case UiElement::Slot:
                 setElementSlot(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"hints"_s, Qt::CaseInsensitive)) {
+            case UiElement::Hints: {
                 auto *v = new DomConnectionHints();
                 v->read(reader);
                 setElementHints(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -5737,6 +8603,40 @@ void DomConnection::write(QXmlStreamWriter &writer, const QString &tagName) cons
     writer.writeEndElement();
 }
 
+void DomConnection::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementSender(reader.readValue<QString>());
+    if (children & (1u << 1))
+        setElementSignal(reader.readValue<QString>());
+    if (children & (1u << 2))
+        setElementReceiver(reader.readValue<QString>());
+    if (children & (1u << 3))
+        setElementSlot(reader.readValue<QString>());
+    if (children & (1u << 4))
+        setElementHints(reader.readNode<DomConnectionHints>());
+}
+
+void DomConnection::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({hasElementSender(),
+                      hasElementSignal(),
+                      hasElementReceiver(),
+                      hasElementSlot(),
+                      hasElementHints()});
+    if (m_children & Sender)
+        writer.writeValue(m_sender);
+    if (m_children & Signal)
+        writer.writeValue(m_signal);
+    if (m_children & Receiver)
+        writer.writeValue(m_receiver);
+    if (m_children & Slot)
+        writer.writeValue(m_slot);
+    if (m_children & Hints)
+        m_hints->write(writer);
+}
+
 void DomConnection::setElementSender(const QString &a)
 {
     m_children |= Sender;
@@ -5815,12 +8715,16 @@ void DomConnectionHints::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"hint"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Hint: {
                 auto *v = new DomConnectionHint();
                 v->read(reader);
                 m_hint.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -5842,6 +8746,20 @@ void DomConnectionHints::write(QXmlStreamWriter &writer, const QString &tagName)
     writer.writeEndElement();
 }
 
+void DomConnectionHints::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementHint(reader.readList<DomConnectionHint>());
+}
+
+void DomConnectionHints::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_hint.isEmpty()});
+    if (!m_hint.isEmpty())
+        writer.writeList(m_hint);
+}
+
 void DomConnectionHints::setElementHint(const QList<DomConnectionHint *> &a)
 {
     m_children |= Hint;
@@ -5855,9 +8773,12 @@ void DomConnectionHint::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"type"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Type:
             setAttributeType(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -5866,13 +8787,15 @@ void DomConnectionHint::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"x"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::X:
                 setElementX(reader.readElementText().toInt());
                 continue;
-            }
-            if (!tag.compare(u"y"_s, Qt::CaseInsensitive)) {
+            case UiElement::Y:
                 setElementY(reader.readElementText().toInt());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -5901,6 +8824,31 @@ void DomConnectionHint::write(QXmlStreamWriter &writer, const QString &tagName)
     writer.writeEndElement();
 }
 
+void DomConnectionHint::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeType(reader.readValue<QString>());
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementX(reader.readValue<int>());
+    if (children & (1u << 1))
+        setElementY(reader.readValue<int>());
+}
+
+void DomConnectionHint::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_type});
+    if (m_has_attr_type)
+        writer.writeValue(m_attr_type);
+    writer.writeMask({hasElementX(),
+                      hasElementY()});
+    if (m_children & X)
+        writer.writeValue(m_x);
+    if (m_children & Y)
+        writer.writeValue(m_y);
+}
+
 void DomConnectionHint::setElementX(int a)
 {
     m_children |= X;
@@ -5935,12 +8883,16 @@ void DomDesignerData::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"property"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Property: {
                 auto *v = new DomProperty();
                 v->read(reader);
                 m_property.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -5962,6 +8914,20 @@ void DomDesignerData::write(QXmlStreamWriter &writer, const QString &tagName) co
     writer.writeEndElement();
 }
 
+void DomDesignerData::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementProperty(reader.readList<DomProperty>());
+}
+
+void DomDesignerData::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_property.isEmpty()});
+    if (!m_property.isEmpty())
+        writer.writeList(m_property);
+}
+
 void DomDesignerData::setElementProperty(const QList<DomProperty *> &a)
 {
     m_children |= Property;
@@ -5980,13 +8946,15 @@ void DomSlots::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"signal"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Signal:
                 m_signal.append(reader.readElementText());
                 continue;
-            }
-            if (!tag.compare(u"slot"_s, Qt::CaseInsensitive)) {
+            case UiElement::Slot:
                 m_slot.append(reader.readElementText());
                 continue;
+            default:
+                break;
             }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
@@ -6012,6 +8980,25 @@ void DomSlots::write(QXmlStreamWriter &writer, const QString &tagName) const
     writer.writeEndElement();
 }
 
+void DomSlots::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementSignal(reader.readValue<QStringList>());
+    if (children & (1u << 1))
+        setElementSlot(reader.readValue<QStringList>());
+}
+
+void DomSlots::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_signal.isEmpty(),
+                      !m_slot.isEmpty()});
+    if (!m_signal.isEmpty())
+        writer.writeValue(m_signal);
+    if (!m_slot.isEmpty())
+        writer.writeValue(m_slot);
+}
+
 void DomSlots::setElementSignal(const QStringList &a)
 {
     m_children |= Signal;
@@ -6038,18 +9025,22 @@ void DomPropertySpecifications::read(QXmlStreamReader &reader)
         switch (reader.readNext()) {
         case QXmlStreamReader::StartElement : {
             const auto tag = reader.name();
-            if (!tag.compare(u"tooltip"_s, Qt::CaseInsensitive)) {
+            switch (uiElement(tag)) {
+            case UiElement::Tooltip: {
                 auto *v = new DomPropertyToolTip();
                 v->read(reader);
                 m_tooltip.append(v);
                 continue;
             }
-            if (!tag.compare(u"stringpropertyspecification"_s, Qt::CaseInsensitive)) {
+            case UiElement::Stringpropertyspecification: {
                 auto *v = new DomStringPropertySpecification();
                 v->read(reader);
                 m_stringpropertyspecification.append(v);
                 continue;
             }
+            default:
+                break;
+            }
             reader.raiseError("Unexpected element "_L1 + tag);
         }
             break;
@@ -6074,6 +9065,25 @@ void DomPropertySpecifications::write(QXmlStreamWriter &writer, const QString &t
     writer.writeEndElement();
 }
 
+void DomPropertySpecifications::read(QUiBinaryReader &reader)
+{
+    const quint32 children = reader.readMask();
+    if (children & (1u << 0))
+        setElementTooltip(reader.readList<DomPropertyToolTip>());
+    if (children & (1u << 1))
+        setElementStringpropertyspecification(reader.readList<DomStringPropertySpecification>());
+}
+
+void DomPropertySpecifications::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({!m_tooltip.isEmpty(),
+                      !m_stringpropertyspecification.isEmpty()});
+    if (!m_tooltip.isEmpty())
+        writer.writeList(m_tooltip);
+    if (!m_stringpropertyspecification.isEmpty())
+        writer.writeList(m_stringpropertyspecification);
+}
+
 void DomPropertySpecifications::setElementTooltip(const QList<DomPropertyToolTip *> &a)
 {
     m_children |= Tooltip;
@@ -6093,9 +9103,12 @@ void DomPropertyToolTip::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -6125,6 +9138,20 @@ void DomPropertyToolTip::write(QXmlStreamWriter &writer, const QString &tagName)
     writer.writeEndElement();
 }
 
+void DomPropertyToolTip::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+}
+
+void DomPropertyToolTip::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+}
+
 DomStringPropertySpecification::~DomStringPropertySpecification() = default;
 
 void DomStringPropertySpecification::read(QXmlStreamReader &reader)
@@ -6132,17 +9159,18 @@ void DomStringPropertySpecification::read(QXmlStreamReader &reader)
     const QXmlStreamAttributes &attributes = reader.attributes();
     for (const QXmlStreamAttribute &attribute : attributes) {
         const auto name = attribute.name();
-        if (name == u"name"_s) {
+        switch (uiAttribute(name)) {
+        case UiAttribute::Name:
             setAttributeName(attribute.value().toString());
             continue;
-        }
-        if (name == u"type"_s) {
+        case UiAttribute::Type:
             setAttributeType(attribute.value().toString());
             continue;
-        }
-        if (name == u"notr"_s) {
+        case UiAttribute::Notr:
             setAttributeNotr(attribute.value().toString());
             continue;
+        default:
+            break;
         }
         reader.raiseError("Unexpected attribute "_L1 + name);
     }
@@ -6178,5 +9206,29 @@ void DomStringPropertySpecification::write(QXmlStreamWriter &writer, const QStri
     writer.writeEndElement();
 }
 
+void DomStringPropertySpecification::read(QUiBinaryReader &reader)
+{
+    const quint32 attributes = reader.readMask();
+    if (attributes & (1u << 0))
+        setAttributeName(reader.readValue<QString>());
+    if (attributes & (1u << 1))
+        setAttributeType(reader.readValue<QString>());
+    if (attributes & (1u << 2))
+        setAttributeNotr(reader.readValue<QString>());
+}
+
+void DomStringPropertySpecification::write(QUiBinaryWriter &writer) const
+{
+    writer.writeMask({m_has_attr_name,
+                      m_has_attr_type,
+                      m_has_attr_notr});
+    if (m_has_attr_name)
+        writer.writeValue(m_attr_name);
+    if (m_has_attr_type)
+        writer.writeValue(m_attr_type);
+    if (m_has_attr_notr)
+        writer.writeValue(m_attr_notr);
+}
+
 QT_END_NAMESPACE
 
@@ -109,6 +109,77 @@ class DomPropertySpecifications;
 class DomPropertyToolTip;
 class DomStringPropertySpecification;
 
+class QUiBinaryReader;
+class QUiBinaryWriter;
+
+/*******************************************************************************
+** Schema signature
+*/
+
+// The attributes and child elements of every type of the schema. The binary
+// form format stores a hash of it to reject files written for another
+// version of the schema.
+inline constexpr char ui4SchemaSignature[] =
+    "UI{author:xs:string,comment:xs:string,exportmacro:xs:string,class:xs:string,widget:Widget,layoutdefault:LayoutDefault,layoutfunction:LayoutFunction,pixmapfunction:xs:string,customwidgets:CustomWidgets,tabstops:TabStops,images:-,includes:Includes,resources:Resources,connections:Connections,designerdata:DesignerData,slots:Slots,buttongroups:ButtonGroups,@version:xs:string,@language:xs:string,@displayname:xs:string,@idbasedtr:xs:boolean,@connectslotsbyname:xs:boolean,@stdsetdef:xs:integer,@stdSetDef:xs:integer}"
+    "Includes{include:Include*}"
+    "Include~{@location:xs:string,@impldecl:xs:string}"
+    "Resources{include:Resource*,@name:xs:string}"
+    "Resource{@location:xs:string}"
+    "ActionGroup{action:Action*,actiongroup:ActionGroup*,property:Property*,attribute:Property*,@name:xs:string}"
+    "Action{property:Property*,attribute:Property*,@name:xs:string,@menu:xs:string}"
+    "ActionRef{@name:xs:string}"
+    "ButtonGroup{property:Property*,attribute:Property*,@name:xs:string}"
+    "ButtonGroups{buttongroup:ButtonGroup*}"
+    "CustomWidgets{customwidget:CustomWidget*}"
+    "Header~{@location:xs:string}"
+    "CustomWidget{class:xs:string,extends:xs:string,header:Header,sizehint:Size,addpagemethod:xs:string,container:xs:integer,sizepolicy:-,pixmap:xs:string,script:-,properties:-,slots:Slots,propertyspecifications:PropertySpecifications}"
+    "LayoutDefault{@spacing:xs:integer,@margin:xs:integer}"
+    "LayoutFunction{@spacing:xs:string,@margin:xs:string}"
+    "TabStops{tabstop:xs:string*}"
+    "Layout{property:Property*,attribute:Property*,item:LayoutItem*,@class:xs:string,@name:xs:string,@stretch:xs:string,@rowstretch:xs:string,@columnstretch:xs:string,@rowminimumheight:xs:string,@columnminimumwidth:xs:string}"
+    "LayoutItem{widget:Widget,layout:Layout,spacer:Spacer,@row:xs:integer,@column:xs:integer,@rowspan:xs:integer,@colspan:xs:integer,@alignment:xs:string}"
+    "Row{property:Property*}"
+    "Column{property:Property*}"
+    "Item{property:Property*,item:Item*,@row:xs:integer,@column:xs:integer}"
+    "Widget{class:xs:string*,property:Property*,script:-,widgetdata:-,attribute:Property*,row:Row*,column:Column*,item:Item*,layout:Layout*,widget:Widget*,action:Action*,actiongroup:ActionGroup*,addaction:ActionRef*,zorder:xs:string*,@class:xs:string,@name:xs:string,@native:xs:boolean}"
+    "Spacer{property:Property*,@name:xs:string}"
+    "Color{red:xs:integer,green:xs:integer,blue:xs:integer,@alpha:xs:integer}"
+    "GradientStop{color:Color,@position:xs:double}"
+    "Gradient{gradientStop:GradientStop*,@startx:xs:double,@starty:xs:double,@endx:xs:double,@endy:xs:double,@centralx:xs:double,@centraly:xs:double,@focalx:xs:double,@focaly:xs:double,@radius:xs:double,@angle:xs:double,@type:xs:string,@spread:xs:string,@coordinatemode:xs:string}"
+    "Brush{color:Color,texture:Property,gradient:Gradient,@brushstyle:xs:string}"
+    "ColorRole{brush:Brush,@role:xs:string}"
+    "ColorGroup{colorrole:ColorRole*,color:Color*}"
+    "Palette{active:ColorGroup,inactive:ColorGroup,disabled:ColorGroup}"
+    "Font{family:xs:string,pointsize:xs:integer,weight:xs:integer,italic:xs:boolean,bold:xs:boolean,underline:xs:boolean,strikeout:xs:boolean,antialiasing:xs:boolean,stylestrategy:xs:string,kerning:xs:boolean}"
+    "Point{x:xs:integer,y:xs:integer}"
+    "Rect{x:xs:integer,y:xs:integer,width:xs:integer,height:xs:integer}"
+    "Locale{@language:xs:string,@country:xs:string}"
+    "SizePolicy{hsizetype:xs:integer,vsizetype:xs:integer,horstretch:xs:integer,verstretch:xs:integer,@hsizetype:xs:string,@vsizetype:xs:string}"
+    "Size{width:xs:integer,height:xs:integer}"
+    "Date{year:xs:integer,month:xs:integer,day:xs:integer}"
+    "Time{hour:xs:integer,minute:xs:integer,second:xs:integer}"
+    "DateTime{hour:xs:integer,minute:xs:integer,second:xs:integer,year:xs:integer,month:xs:integer,day:xs:integer}"
+    "StringList{@notr:xs:string,@comment:xs:string,@extracomment:xs:string,@id:xs:string,string:xs:string*}"
+    "ResourcePixmap~{@resource:xs:string,@alias:xs:string}"
+    "ResourceIcon~{normaloff:ResourcePixmap,normalon:ResourcePixmap,disabledoff:ResourcePixmap,disabledon:ResourcePixmap,activeoff:ResourcePixmap,activeon:ResourcePixmap,selectedoff:ResourcePixmap,selectedon:ResourcePixmap,@theme:xs:string,@resource:xs:string}"
+    "String~{@notr:xs:string,@comment:xs:string,@extracomment:xs:string,@id:xs:string}"
+    "PointF{x:xs:double,y:xs:double}"
+    "RectF{x:xs:double,y:xs:double,width:xs:double,height:xs:double}"
+    "SizeF{width:xs:double,height:xs:double}"
+    "Char{unicode:xs:integer}"
+    "Url{string:String}"
+    "Property{bool:xs:string,color:Color,cstring:xs:string,cursor:xs:integer,cursorshape:xs:string,enum:xs:string,font:Font,iconset:ResourceIcon,pixmap:ResourcePixmap,palette:Palette,point:Point,rect:Rect,set:xs:string,locale:Locale,sizepolicy:SizePolicy,size:Size,string:String,stringlist:StringList,number:xs:integer,float:xs:float,double:xs:double,date:Date,time:Time,datetime:DateTime,pointf:PointF,rectf:RectF,sizef:SizeF,longlong:xs:long,char:Char,url:Url,uint:xs:unsignedInt,ulonglong:xs:unsignedLong,brush:Brush,@name:xs:string,@stdset:xs:integer}"
+    "Connections{connection:Connection*}"
+    "Connection{sender:xs:string,signal:xs:string,receiver:xs:string,slot:xs:string,hints:ConnectionHints}"
+    "ConnectionHints{hint:ConnectionHint*}"
+    "ConnectionHint{x:xs:integer,y:xs:integer,@type:xs:string}"
+    "DesignerData{property:Property*}"
+    "Slots{signal:xs:string*,slot:xs:string*}"
+    "PropertySpecifications{tooltip:PropertyToolTip*,stringpropertyspecification:StringPropertySpecification*}"
+    "PropertyToolTip{@name:xs:string}"
+    "StringPropertySpecification{@name:xs:string,@type:xs:string,@notr:xs:string}"
+    ;
+
 /*******************************************************************************
 ** Declarations
 */
@@ -121,6 +192,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeVersion() const { return m_has_attr_version; }
@@ -320,6 +393,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomInclude *> elementInclude() const { return m_include; }
@@ -344,6 +419,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     inline QString text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
@@ -378,6 +455,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -411,6 +490,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeLocation() const { return m_has_attr_location; }
@@ -432,6 +513,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -480,6 +563,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -526,6 +611,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -547,6 +634,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -585,6 +674,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomButtonGroup *> elementButtonGroup() const { return m_buttonGroup; }
@@ -609,6 +700,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomCustomWidget *> elementCustomWidget() const { return m_customWidget; }
@@ -633,6 +726,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     inline QString text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
@@ -659,6 +754,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QString elementClass() const { return m_class; }
@@ -745,6 +842,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeSpacing() const { return m_has_attr_spacing; }
@@ -774,6 +873,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeSpacing() const { return m_has_attr_spacing; }
@@ -803,6 +904,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QStringList elementTabStop() const { return m_tabStop; }
@@ -827,6 +930,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeClass() const { return m_has_attr_class; }
@@ -918,6 +1023,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeRow() const { return m_has_attr_row; }
@@ -995,6 +1102,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomProperty *> elementProperty() const { return m_property; }
@@ -1019,6 +1128,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomProperty *> elementProperty() const { return m_property; }
@@ -1043,6 +1154,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeRow() const { return m_has_attr_row; }
@@ -1089,6 +1202,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeClass() const { return m_has_attr_class; }
@@ -1193,6 +1308,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -1226,6 +1343,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeAlpha() const { return m_has_attr_alpha; }
@@ -1275,6 +1394,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributePosition() const { return m_has_attr_position; }
@@ -1311,6 +1432,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeStartX() const { return m_has_attr_startX; }
@@ -1440,6 +1563,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeBrushStyle() const { return m_has_attr_brushStyle; }
@@ -1485,6 +1610,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeRole() const { return m_has_attr_role; }
@@ -1521,6 +1648,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomColorRole *> elementColorRole() const { return m_colorRole; }
@@ -1550,6 +1679,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline DomColorGroup *elementActive() const { return m_active; }
@@ -1593,6 +1724,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QString elementFamily() const { return m_family; }
@@ -1682,6 +1815,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementX() const { return m_x; }
@@ -1715,6 +1850,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementX() const { return m_x; }
@@ -1762,6 +1899,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeLanguage() const { return m_has_attr_language; }
@@ -1791,6 +1930,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeHSizeType() const { return m_has_attr_hSizeType; }
@@ -1855,6 +1996,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementWidth() const { return m_width; }
@@ -1888,6 +2031,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementYear() const { return m_year; }
@@ -1928,6 +2073,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementHour() const { return m_hour; }
@@ -1968,6 +2115,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementHour() const { return m_hour; }
@@ -2029,6 +2178,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeNotr() const { return m_has_attr_notr; }
@@ -2086,6 +2237,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     inline QString text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
@@ -2120,6 +2273,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     inline QString text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
@@ -2225,6 +2380,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     inline QString text() const { return m_text; }
     inline void setText(const QString &s) { m_text = s; }
@@ -2275,6 +2432,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline double elementX() const { return m_x; }
@@ -2308,6 +2467,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline double elementX() const { return m_x; }
@@ -2355,6 +2516,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline double elementWidth() const { return m_width; }
@@ -2388,6 +2551,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline int elementUnicode() const { return m_unicode; }
@@ -2414,6 +2579,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline DomString *elementString() const { return m_string; }
@@ -2441,6 +2608,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -2632,6 +2801,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomConnection *> elementConnection() const { return m_connection; }
@@ -2656,6 +2827,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QString elementSender() const { return m_sender; }
@@ -2711,6 +2884,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomConnectionHint *> elementHint() const { return m_hint; }
@@ -2735,6 +2910,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeType() const { return m_has_attr_type; }
@@ -2777,6 +2954,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomProperty *> elementProperty() const { return m_property; }
@@ -2801,6 +2980,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QStringList elementSignal() const { return m_signal; }
@@ -2830,6 +3011,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // child element accessors
     inline QList<DomPropertyToolTip *> elementTooltip() const { return m_tooltip; }
@@ -2859,6 +3042,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -2880,6 +3065,8 @@ public:
 
     void read(QXmlStreamReader &reader);
     void write(QXmlStreamWriter &writer, const QString &tagName = QString()) const;
+    void read(QUiBinaryReader &reader);
+    void write(QUiBinaryWriter &writer) const;
 
     // attribute accessors
     inline bool hasAttributeName() const { return m_has_attr_name; }
@@ -0,0 +1,126 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "uibinaryformat_p.h"
+#include "ui4_p.h"
+
+#include <QtCore/qbuffer.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qiodevice.h>
+
+QT_BEGIN_NAMESPACE
+
+#ifdef QFORMINTERNAL_NAMESPACE
+namespace QFormInternal {
+#endif
+
+/*
+    The file starts with a magic number, a format version and a hash of the
+    schema, followed by the table of all strings used in the form and the
+    DOM tree. The DOM classes generated from ui4.xsd read and write the nodes
+    with QUiBinaryReader and QUiBinaryWriter.
+*/
+
+static const quint32 uiBinaryMagic = 0x51554942; // "QUIB"
+static const quint32 uiBinaryVersion = 3;
+
+static constexpr quint32 schemaHash(const char *signature)
+{
+    quint32 hash = 2166136261u; // FNV-1a
+    for (; *signature; ++signature)
+        hash = (hash ^ quint8(*signature)) * 16777619u;
+    return hash;
+}
+
+static constexpr quint32 uiSchemaHash = schemaHash(ui4SchemaSignature);
+
+/*!
+    \internal
+
+    Returns whether \a dev contains a form in the binary format, without
+    consuming any data.
+*/
+bool QUiBinaryFormat::canRead(QIODevice *dev)
+{
+    const QByteArray header = dev->peek(sizeof(quint32));
+    if (header.size() != sizeof(quint32))
+        return false;
+    QDataStream stream(header);
+    quint32 magic = 0;
+    stream >> magic;
+    return magic == uiBinaryMagic;
+}
+
+/*!
+    \internal
+
+    Reads a form written by write() from \a dev. Returns \nullptr and sets
+    \a errorMessage if the data is not a valid form in the binary format.
+*/
+DomUI *QUiBinaryFormat::read(QIODevice *dev, QString *errorMessage)
+{
+    QDataStream stream(dev);
+    stream.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 schema = 0;
+    stream >> magic >> version >> schema;
+    const bool compatible = magic == uiBinaryMagic && version == uiBinaryVersion
+            && schema == uiSchemaHash;
+
+    // Read the string table one by one rather than trusting its size.
+    QStringList strings;
+    quint32 stringCount = 0;
+    if (compatible)
+        stream >> stringCount;
+    for (quint32 i = 0; i < stringCount && stream.status() == QDataStream::Ok; ++i) {
+        QString string;
+        stream >> string;
+        strings.append(string);
+    }
+
+    DomUI *ui = nullptr;
+    if (stream.status() == QDataStream::Ok && compatible) {
+        QUiBinaryReader reader(dev, strings);
+        ui = reader.readNode<DomUI>();
+        if (reader.hasError()) {
+            delete ui;
+            ui = nullptr;
+        }
+    }
+
+    if (!ui && errorMessage) {
+        *errorMessage = QCoreApplication::translate("QAbstractFormBuilder",
+                                                    "Invalid binary UI file");
+    }
+    return ui;
+}
+
+/*!
+    \internal
+
+    Writes \a ui to \a dev in the binary format.
+*/
+bool QUiBinaryFormat::write(const DomUI *ui, QIODevice *dev)
+{
+    // The string table precedes the tree, so collect it first.
+    QBuffer body;
+    body.open(QIODevice::WriteOnly);
+    QUiBinaryWriter writer(&body);
+    ui->write(writer);
+    if (writer.hasError())
+        return false;
+
+    QDataStream stream(dev);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << uiBinaryMagic << uiBinaryVersion << uiSchemaHash << writer.strings();
+    const QByteArray &data = body.data();
+    stream.writeRawData(data.constData(), data.size());
+    return stream.status() == QDataStream::Ok;
+}
+
+#ifdef QFORMINTERNAL_NAMESPACE
+} // namespace QFormInternal
+#endif
+
+QT_END_NAMESPACE
@@ -0,0 +1,186 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef UIBINARYFORMAT_H
+#define UIBINARYFORMAT_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "uilib_global.h"
+
+#include <QtCore/qdatastream.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+
+#include <initializer_list>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+#ifdef QFORMINTERNAL_NAMESPACE
+namespace QFormInternal
+{
+#endif
+
+class DomUI;
+
+// A compact binary serialization of the DomUI tree of a form. Strings are
+// stored once in a table and shared between the DOM nodes when reading,
+// which avoids the XML tokenizing and the per attribute allocations.
+class QDESIGNER_UILIB_EXPORT QUiBinaryFormat
+{
+public:
+    static bool canRead(QIODevice *dev);
+    static DomUI *read(QIODevice *dev, QString *errorMessage = nullptr);
+    static bool write(const DomUI *ui, QIODevice *dev);
+};
+
+// The streams passed to the read() and write() overloads of the DOM classes
+// generated from ui4.xsd. Each node is a bit mask of the attributes present
+// followed by their values, then the same for its child elements. Nodes
+// holding one of several kinds of values write their kind instead of an
+// element mask. Strings are written as indexes into a table.
+class QUiBinaryWriter
+{
+public:
+    explicit QUiBinaryWriter(QIODevice *dev) : m_stream(dev)
+    {
+        m_stream.setVersion(QDataStream::Qt_6_0);
+    }
+
+    QStringList strings() const { return m_strings; }
+    bool hasError() const { return m_stream.status() != QDataStream::Ok; }
+
+    void writeMask(std::initializer_list<bool> present)
+    {
+        quint32 mask = 0;
+        quint32 bit = 1;
+        for (bool p : present) {
+            if (p)
+                mask |= bit;
+            bit <<= 1;
+        }
+        m_stream << mask;
+    }
+
+    template <typename T>
+    void writeValue(const T &value)
+    {
+        if constexpr (std::is_same_v<T, QString>) {
+            auto it = m_stringIndexes.constFind(value);
+            if (it == m_stringIndexes.constEnd()) {
+                it = m_stringIndexes.insert(value, quint32(m_strings.size()));
+                m_strings.append(value);
+            }
+            m_stream << it.value();
+        } else if constexpr (std::is_same_v<T, QStringList>) {
+            m_stream << quint32(value.size());
+            for (const QString &v : value)
+                writeValue(v);
+        } else {
+            m_stream << value;
+        }
+    }
+
+    template <typename T>
+    void writeList(const QList<T *> &nodes)
+    {
+        m_stream << quint32(nodes.size());
+        for (const T *node : nodes)
+            node->write(*this);
+    }
+
+private:
+    QDataStream m_stream;
+    QStringList m_strings;
+    QHash<QString, quint32> m_stringIndexes;
+};
+
+class QUiBinaryReader
+{
+public:
+    QUiBinaryReader(QIODevice *dev, const QStringList &strings)
+        : m_stream(dev), m_strings(strings)
+    {
+        m_stream.setVersion(QDataStream::Qt_6_0);
+    }
+
+    bool hasError() const { return m_stream.status() != QDataStream::Ok; }
+    void raiseError() { m_stream.setStatus(QDataStream::ReadCorruptData); }
+
+    quint32 readMask() { return readValue<quint32>(); }
+
+    template <typename T>
+    T readValue()
+    {
+        T value{};
+        if constexpr (std::is_same_v<T, QString>) {
+            const quint32 index = readValue<quint32>();
+            if (index < quint32(m_strings.size()))
+                value = m_strings.at(index);
+            else
+                raiseError();
+        } else if constexpr (std::is_same_v<T, QStringList>) {
+            const quint32 count = readValue<quint32>();
+            for (quint32 i = 0; i < count && !hasError(); ++i)
+                value.append(readValue<QString>());
+        } else {
+            m_stream >> value;
+        }
+        return value;
+    }
+
+    // Cache files may be corrupt, so the nesting of the nodes is bounded
+    // instead of recursing as deep as the data says.
+    template <typename T>
+    T *readNode()
+    {
+        auto *node = new T;
+        if (m_depth < maxDepth) {
+            ++m_depth;
+            node->read(*this);
+            --m_depth;
+        } else {
+            raiseError();
+        }
+        return node;
+    }
+
+    template <typename T>
+    QList<T *> readList()
+    {
+        QList<T *> nodes;
+        const quint32 count = readValue<quint32>();
+        for (quint32 i = 0; i < count && !hasError(); ++i)
+            nodes.append(readNode<T>());
+        return nodes;
+    }
+
+    static constexpr int maxDepth = 1024;
+
+private:
+    QDataStream m_stream;
+    const QStringList m_strings;
+    int m_depth = 0;
+};
+
+#ifdef QFORMINTERNAL_NAMESPACE
+}
+#endif
+
+QT_END_NAMESPACE
+
+#endif // UIBINARYFORMAT_H
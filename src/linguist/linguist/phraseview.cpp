@@ -56,6 +56,17 @@ PhraseView::PhraseView(MultiDataModel *model, QList<QHash<QString, QList<Phrase
 
     connect(this, &QAbstractItemView::activated,
             this, &PhraseView::selectPhrase);
+
+    connect(m_dataModel, &MultiDataModel::translationChanged,
+            this, &PhraseView::updateGuessIndex);
+    connect(m_dataModel, &MultiDataModel::messageDataChanged,
+            this, &PhraseView::updateGuessIndex);
+    connect(m_dataModel, &MultiDataModel::modelAppended,
+            this, &PhraseView::invalidateGuessIndexes);
+    connect(m_dataModel, &MultiDataModel::modelDeleted,
+            this, &PhraseView::invalidateGuessIndexes);
+    connect(m_dataModel, &MultiDataModel::allModelsDeleted,
+            this, &PhraseView::invalidateGuessIndexes);
 }
 
 PhraseView::~PhraseView()
@@ -172,53 +183,57 @@ void PhraseView::resetNumGuesses()
     setSourceText(m_modelIndex, m_sourceText);
 }
 
-static CandidateList similarTextHeuristicCandidates(MultiDataModel *model, int mi,
-    const char *text, int maxCandidates)
+static void setGuessCandidate(SimilarTextIndex *guesses, int i, const MessageItem *m)
 {
-    QList<int> scores;
-    CandidateList candidates;
-
-    StringSimilarityMatcher stringmatcher(QString::fromLatin1(text));
-
-    for (MultiDataModelIterator it(model, mi); it.isValid(); ++it) {
-        MessageItem *m = it.current();
-        if (!m)
-            continue;
-
-        TranslatorMessage mtm = m->message();
-        if (mtm.type() == TranslatorMessage::Unfinished
-            || mtm.translation().isEmpty())
-            continue;
-
-        QString s = m->text();
-
-        int score = stringmatcher.getSimilarityScore(s);
-
-        if (candidates.count() == maxCandidates && score > scores[maxCandidates - 1])
-            candidates.removeLast();
-        if (candidates.count() < maxCandidates && score >= textSimilarityThreshold ) {
-            Candidate cand(mtm.context(), s, mtm.comment(), mtm.translation());
-
-            int i;
-            for (i = 0; i < candidates.size(); ++i) {
-                if (score >= scores.at(i)) {
-                    if (score == scores.at(i)) {
-                        if (candidates.at(i) == cand)
-                            goto continue_outer_loop;
-                    } else {
-                        break;
-                    }
-                }
-            }
-            scores.insert(i, score);
-            candidates.insert(i, cand);
+    if (m && m->type() != TranslatorMessage::Unfinished && !m->translation().isEmpty()) {
+        const TranslatorMessage &mtm = m->message();
+        guesses->setCandidate(i, Candidate(mtm.context(), m->text(), mtm.comment(),
+                                           mtm.translation()));
+    } else {
+        guesses->removeCandidate(i);
+    }
+}
+
+// The guess indexes have one entry per message of the multi data model,
+// in iteration order, and are built for each model when first needed.
+const SimilarTextIndex &PhraseView::guessIndex(int model)
+{
+    if (m_guessIndexes.isEmpty()) {
+        m_guessMessageCount = 0;
+        for (int c = 0; c < m_dataModel->contextCount(); ++c) {
+            m_guessContextOffsets.append(m_guessMessageCount);
+            m_guessMessageCount += m_dataModel->multiContextItem(c)->messageCount();
         }
-        continue_outer_loop:
-        ;
+        m_guessIndexes.resize(m_dataModel->modelCount());
     }
-    return candidates;
+
+    SimilarTextIndex &guesses = m_guessIndexes[model];
+    if (guesses.count() != m_guessMessageCount) {
+        guesses.resize(m_guessMessageCount);
+        for (MultiDataModelIterator it(m_dataModel, model); it.isValid(); ++it) {
+            if (MessageItem *m = it.current())
+                setGuessCandidate(&guesses, m_guessContextOffsets.at(it.context()) + it.message(), m);
+        }
+    }
+    return guesses;
 }
 
+void PhraseView::updateGuessIndex(const MultiDataIndex &index)
+{
+    if (index.model() < 0 || index.model() >= m_guessIndexes.size())
+        return;
+    SimilarTextIndex &guesses = m_guessIndexes[index.model()];
+    const int i = m_guessContextOffsets.at(index.context()) + index.message();
+    if (i < guesses.count())
+        setGuessCandidate(&guesses, i, m_dataModel->messageItem(index));
+}
+
+void PhraseView::invalidateGuessIndexes()
+{
+    m_guessIndexes.clear();
+    m_guessContextOffsets.clear();
+    m_guessMessageCount = 0;
+}
 
 void PhraseView::setSourceText(int model, const QString &sourceText)
 {
@@ -235,8 +250,8 @@ void PhraseView::setSourceText(int model, const QString &sourceText)
         m_phraseModel->addPhrase(p);
 
     if (!sourceText.isEmpty() && m_doGuesses) {
-        const CandidateList cl = similarTextHeuristicCandidates(m_dataModel, model,
-            sourceText.toLatin1(), m_maxCandidates);
+        const CandidateList cl = guessIndex(model).candidates(
+            QString::fromLatin1(sourceText.toLatin1()), m_maxCandidates);
         int n = 0;
         for (const Candidate &candidate : cl) {
             QString def;
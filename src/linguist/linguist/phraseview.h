@@ -12,6 +12,7 @@ QT_BEGIN_NAMESPACE
 
 static const int DefaultMaxCandidates = 5;
 
+class MultiDataIndex;
 class MultiDataModel;
 class PhraseModel;
 
@@ -51,10 +52,13 @@ private slots:
     void selectCurrentPhrase();
     void editPhrase();
     void gotoMessageFromGuess();
+    void updateGuessIndex(const MultiDataIndex &index);
+    void invalidateGuessIndexes();
 
 private:
     QList<Phrase *> getPhrases(int model, const QString &sourceText);
     void deleteGuesses();
+    const SimilarTextIndex &guessIndex(int model);
 
     MultiDataModel *m_dataModel;
     QList<QHash<QString, QList<Phrase *> > > *m_phraseDict;
@@ -64,6 +68,9 @@ private:
     int m_modelIndex;
     bool m_doGuesses;
     int m_maxCandidates = DefaultMaxCandidates;
+    QList<SimilarTextIndex> m_guessIndexes;
+    QList<int> m_guessContextOffsets;
+    int m_guessMessageCount = 0;
 };
 
 QT_END_NAMESPACE
@@ -2,13 +2,18 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
 #include "cpp.h"
+#include "extractioncache.h"
 
 #include <translator.h>
 #include <QtCore/QBitArray>
 #include <QtCore/QStack>
 #include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 #include <QtCore/QRegularExpression>
 
+#include <sstream>
+
 QT_BEGIN_NAMESPACE
 
 
@@ -22,35 +27,31 @@ static QString MagicComment(QLatin1String("TRANSLATOR"));
 
 size_t qHash(const HashString &str)
 {
-    if (str.m_hash & 0x80000000)
-        str.m_hash = qHash(str.m_str) & 0x7fffffff;
     return str.m_hash;
 }
 
 size_t qHash(const HashStringList &list)
 {
-    if (list.m_hash & 0x80000000) {
-        uint hash = 0;
-        for (const HashString &qs : list.m_list) {
-            hash ^= qHash(qs) ^ 0x6ad9f526;
-            hash = ((hash << 13) & 0x7fffffff) | (hash >> 18);
-        }
-        list.m_hash = hash;
-    }
     return list.m_hash;
 }
 
-static int nextFileId;
+static QAtomicInt nextFileId;
+
+// Guards the tr() qualifications computed on demand, which may be stored
+// in the namespaces of files shared with other parser threads.
+Q_GLOBAL_STATIC(QMutex, namespaceMutex)
 
 class VisitRecorder {
 public:
     VisitRecorder()
     {
-        m_ba.resize(nextFileId);
+        m_ba.resize(nextFileId.loadRelaxed());
     }
     bool tryVisit(int fileId)
     {
-        if (m_ba.at(fileId))
+        if (fileId >= m_ba.size())
+            m_ba.resize(fileId + 1);
+        else if (m_ba.at(fileId))
             return false;
         m_ba[fileId] = true;
         return true;
@@ -79,6 +80,8 @@ public:
     void parseInternal(ConversionData &cd, const QStringList &includeStack, QSet<QString> &inclusions);
     const ParseResults *recordResults(bool isHeader);
     void deleteResults() { delete results; }
+    void dependencies(QStringList *fileNames, QStringList *directIncludes) const;
+    std::string diagnostics() const { return yyDiagnostics.str(); }
 
 private:
     struct IfdefState {
@@ -148,6 +151,7 @@ private:
                         VisitRecorder &vr, const ParseResults *rslt) const;
     bool visitNamespace(const NamespaceList &namespaces, int nsCount,
                         VisitNamespaceCallback callback, void *context) const;
+    bool isOwnNamespace(const Namespace *ns, const NamespaceList &namespaces, int nsCount) const;
     bool qualifyOneCallbackOwn(const Namespace *ns, void *context) const;
     bool qualifyOneCallbackUsing(const Namespace *ns, void *context) const;
     bool qualifyOne(const NamespaceList &namespaces, int nsCnt, const HashString &segment,
@@ -169,6 +173,10 @@ private:
     void truncateNamespaces(NamespaceList *namespaces, int lenght);
     Namespace *modifyNamespace(NamespaceList *namespaces, bool haveLast = true);
 
+    // Warnings, printed by the caller so that files parsed in parallel
+    // do not interleave them
+    std::ostringstream yyDiagnostics;
+
     // Tokenizer state
     QString yyFileName;
     int yyCh;
@@ -206,6 +214,8 @@ private:
     ParseResults *results;
     Translator *tor;
     bool directInclude;
+    int publications;
+    mutable QSet<const NamespaceList *> resolvingAliases;
 
     CppParserState savedState;
     int yyMinBraceDepth;
@@ -215,6 +225,7 @@ private:
 CppParser::CppParser(ParseResults *_results)
 {
     tor = 0;
+    publications = 0;
     if (_results) {
         results = _results;
         directInclude = true;
@@ -237,7 +248,7 @@ CppParser::CppParser(ParseResults *_results)
 
 std::ostream &CppParser::yyMsg(int line)
 {
-    return std::cerr << qPrintable(yyFileName) << ':' << (line ? line : yyLineNo) << ": ";
+    return yyDiagnostics << qPrintable(yyFileName) << ':' << (line ? line : yyLineNo) << ": ";
 }
 
 void CppParser::setInput(const QString &in)
@@ -979,6 +990,15 @@ struct QualifyOneData {
     QSet<HashStringList> *visitedUsings;
 };
 
+bool CppParser::isOwnNamespace(const Namespace *ns, const NamespaceList &namespaces,
+                               int nsCount) const
+{
+    const Namespace *own = &results->rootNamespace;
+    for (int i = 1; own && i < nsCount; ++i)
+        own = own->children.value(namespaces.at(i));
+    return own == ns;
+}
+
 bool CppParser::qualifyOneCallbackOwn(const Namespace *ns, void *context) const
 {
     QualifyOneData *data = (QualifyOneData *)context;
@@ -991,14 +1011,30 @@ bool CppParser::qualifyOneCallbackOwn(const Namespace *ns, void *context) const
     if (nsai != ns->aliases.constEnd()) {
         const NamespaceList &nsl = *nsai;
         if (nsl.last().value().isEmpty()) { // Delayed alias resolution
-            NamespaceList &nslIn = *const_cast<NamespaceList *>(&nsl);
+            NamespaceList nslIn = nsl;
             nslIn.removeLast();
+            // An alias that is being resolved stands for its unresolved name.
+            if (resolvingAliases.contains(&nsl)) {
+                *data->resolved = nslIn;
+                return true;
+            }
+            resolvingAliases.insert(&nsl);
             NamespaceList nslOut;
-            if (!fullyQualify(data->namespaces, data->nsCount, nslIn, false, &nslOut, 0)) {
-                const_cast<Namespace *>(ns)->aliases.remove(data->segment);
-                return false;
+            const bool resolved = fullyQualify(data->namespaces, data->nsCount, nslIn, false,
+                                               &nslOut, 0);
+            resolvingAliases.remove(&nsl);
+            // Only the namespaces of this file remember the resolution, the
+            // ones of other files may be in use by other parser threads.
+            if (isOwnNamespace(ns, data->namespaces, data->nsCount)) {
+                if (resolved)
+                    *const_cast<NamespaceList *>(&nsl) = nslOut;
+                else
+                    const_cast<Namespace *>(ns)->aliases.remove(data->segment);
             }
-            nslIn = nslOut;
+            if (!resolved)
+                return false;
+            *data->resolved = nslOut;
+            return true;
         }
         *data->resolved = nsl;
         return true;
@@ -1132,6 +1168,13 @@ void CppParser::truncateNamespaces(NamespaceList *namespaces, int length)
   Functions for processing include files.
 */
 
+QMutex &CppFiles::mutex()
+{
+    static QMutex mutex;
+
+    return mutex;
+}
+
 IncludeCycleHash &CppFiles::includeCycles()
 {
     static IncludeCycleHash cycles;
@@ -1146,6 +1189,13 @@ TranslatorHash &CppFiles::translatedFiles()
     return tors;
 }
 
+QHash<QString, int> &CppFiles::publishedFiles()
+{
+    static QHash<QString, int> published;
+
+    return published;
+}
+
 QSet<QString> &CppFiles::blacklistedFiles()
 {
     static QSet<QString> blacklisted;
@@ -1155,6 +1205,7 @@ QSet<QString> &CppFiles::blacklistedFiles()
 
 QSet<const ParseResults *> CppFiles::getResults(const QString &cleanFile)
 {
+    QMutexLocker locker(&mutex());
     IncludeCycle * const cycle = includeCycles().value(cleanFile);
 
     if (cycle)
@@ -1163,41 +1214,64 @@ QSet<const ParseResults *> CppFiles::getResults(const QString &cleanFile)
         return QSet<const ParseResults *>();
 }
 
-void CppFiles::setResults(const QString &cleanFile, const ParseResults *results)
+const Translator *CppFiles::getTranslator(const QString &cleanFile)
 {
-    IncludeCycle *cycle = includeCycles().value(cleanFile);
-
-    if (!cycle) {
-        cycle = new IncludeCycle;
-        includeCycles().insert(cleanFile, cycle);
-    }
-
-    cycle->fileNames.insert(cleanFile);
-    cycle->results.insert(results);
+    QMutexLocker locker(&mutex());
+    return translatedFiles().value(cleanFile);
 }
 
-const Translator *CppFiles::getTranslator(const QString &cleanFile)
+// Returns how often the results of \a cleanFile were published so far.
+int CppFiles::publications(const QString &cleanFile)
 {
-    return translatedFiles().value(cleanFile);
+    QMutexLocker locker(&mutex());
+    return publishedFiles().value(cleanFile);
 }
 
-void CppFiles::setTranslator(const QString &cleanFile, const Translator *tor)
+// Publishes the \a results and the translator \a tor of \a cleanFile,
+// unless another thread published the file after it had been published
+// \a publications times. Parsing the same file in several threads then
+// only produces one set of messages. Returns whether it was published.
+bool CppFiles::publish(const QString &cleanFile, int publications,
+                       const ParseResults *results, const Translator *tor)
 {
-    translatedFiles().insert(cleanFile, tor);
+    QMutexLocker locker(&mutex());
+    int &published = publishedFiles()[cleanFile];
+    if (published != publications)
+        return false;
+    ++published;
+
+    if (tor)
+        translatedFiles().insert(cleanFile, tor);
+
+    if (results) {
+        IncludeCycle *cycle = includeCycles().value(cleanFile);
+
+        if (!cycle) {
+            cycle = new IncludeCycle;
+            includeCycles().insert(cleanFile, cycle);
+        }
+
+        cycle->fileNames.insert(cleanFile);
+        cycle->results.insert(results);
+    }
+    return true;
 }
 
 bool CppFiles::isBlacklisted(const QString &cleanFile)
 {
+    QMutexLocker locker(&mutex());
     return blacklistedFiles().contains(cleanFile);
 }
 
 void CppFiles::setBlacklisted(const QString &cleanFile)
 {
+    QMutexLocker locker(&mutex());
     blacklistedFiles().insert(cleanFile);
 }
 
 void CppFiles::addIncludeCycle(const QSet<QString> &fileNames)
 {
+    QMutexLocker locker(&mutex());
     IncludeCycle * const cycle = new IncludeCycle;
     cycle->fileNames = fileNames;
 
@@ -1234,6 +1308,7 @@ void CppParser::processInclude(const QString &file, ConversionData &cd, const QS
         if (rx.match(cleanFile).hasMatch())
             return;
     }
+    results->fileNames.insert(cleanFile);
 
     const int index = includeStack.indexOf(cleanFile);
     if (index != -1) {
@@ -1284,6 +1359,7 @@ void CppParser::processInclude(const QString &file, ConversionData &cd, const QS
         stack << cleanFile;
         parser.parse(cd, stack, inclusions);
         results->includes.insert(parser.recordResults(true));
+        yyDiagnostics << parser.yyDiagnostics.str();
     } else {
         CppParser parser(results);
         parser.namespaces = namespaces;
@@ -1294,8 +1370,10 @@ void CppParser::processInclude(const QString &file, ConversionData &cd, const QS
         QStringList stack = includeStack;
         stack << cleanFile;
         parser.parseInternal(cd, stack, inclusions);
+        yyDiagnostics << parser.yyDiagnostics.str();
         // Avoid that messages obtained by direct scanning are used
         CppFiles::setBlacklisted(cleanFile);
+        results->directIncludes.insert(cleanFile);
     }
     inclusions.remove(cleanFile);
 
@@ -1460,6 +1538,7 @@ void CppParser::handleTr(QString &prefix, bool plural)
                     return;
                 }
                 Namespace *fctx;
+                QMutexLocker locker(namespaceMutex());
                 while (!(fctx = findNamespace(functionContext, idx)->classDef)->hasTrFunctions) {
                     if (idx == 1) {
                         context = stringifyNamespace(functionContext);
@@ -1501,6 +1580,7 @@ void CppParser::handleTr(QString &prefix, bool plural)
             NamespaceList nsl;
             NamespaceList unresolved;
             if (fullyQualify(functionContext, prefix, false, &nsl, &unresolved)) {
+                QMutexLocker locker(namespaceMutex());
                 Namespace *fctx = findNamespace(nsl)->classDef;
                 if (fctx->trQualification.isEmpty()) {
                     context = stringifyNamespace(nsl);
@@ -1628,6 +1708,8 @@ void CppParser::parse(ConversionData &cd, const QStringList &includeStack,
     namespaces << HashString();
     functionContext = namespaces;
     functionContextUnresolved.clear();
+    publications = CppFiles::publications(yyFileName);
+    results->fileNames.insert(yyFileName);
 
     parseInternal(cd, includeStack, inclusions);
 }
@@ -2178,16 +2260,12 @@ void CppParser::processComment()
 
 const ParseResults *CppParser::recordResults(bool isHeader)
 {
-    if (tor) {
-        if (tor->messageCount()) {
-            CppFiles::setTranslator(yyFileName, tor);
-        } else {
-            delete tor;
-            tor = 0;
-        }
+    if (tor && !tor->messageCount()) {
+        delete tor;
+        tor = 0;
     }
+    const ParseResults *pr = 0;
     if (isHeader) {
-        const ParseResults *pr;
         if (!tor && results->includes.count() == 1
             && results->rootNamespace.children.isEmpty()
             && results->rootNamespace.aliases.isEmpty()
@@ -2196,30 +2274,98 @@ const ParseResults *CppParser::recordResults(bool isHeader)
             pr = *results->includes.cbegin();
             delete results;
         } else {
-            results->fileId = nextFileId++;
+            results->fileId = nextFileId.fetchAndAddRelaxed(1);
             pr = results;
         }
-        CppFiles::setResults(yyFileName, pr);
-        return pr;
     } else {
         delete results;
-        return 0;
     }
+    // If another thread has parsed the file in the meantime, the results
+    // are kept private to the including file, and the messages and warnings
+    // are dropped.
+    if (!CppFiles::publish(yyFileName, publications, pr, tor)) {
+        delete tor;
+        tor = 0;
+        yyDiagnostics.str(std::string());
+    }
+    return pr;
+}
+
+static void collectDependencies(const ParseResults *pr, QSet<const ParseResults *> *visited,
+                                QSet<QString> *fileNames, QSet<QString> *directIncludes)
+{
+    if (visited->contains(pr))
+        return;
+    visited->insert(pr);
+    fileNames->unite(pr->fileNames);
+    directIncludes->unite(pr->directIncludes);
+    for (const ParseResults *include : pr->includes)
+        collectDependencies(include, visited, fileNames, directIncludes);
+}
+
+static void collectDependencies(const QSet<const ParseResults *> &rslts,
+                                QStringList *fileNames, QStringList *directIncludes)
+{
+    QSet<const ParseResults *> visited;
+    QSet<QString> fileNameSet;
+    QSet<QString> directIncludeSet;
+    for (const ParseResults *pr : rslts)
+        collectDependencies(pr, &visited, &fileNameSet, &directIncludeSet);
+    *fileNames = fileNameSet.values();
+    fileNames->sort();
+    *directIncludes = directIncludeSet.values();
+    directIncludes->sort();
+}
+
+// Returns the files the parsed file depends on, including the file itself,
+// and the files that were parsed as part of it.
+void CppParser::dependencies(QStringList *fileNames, QStringList *directIncludes) const
+{
+    collectDependencies(QSet<const ParseResults *>{ results }, fileNames, directIncludes);
 }
 
-void loadCPP(Translator &translator, const QStringList &filenames, ConversionData &cd)
+void loadCPP(Translator &translator, const QStringList &filenames, ConversionData &cd,
+             ExtractionCache *cache)
 {
     QStringConverter::Encoding e = cd.m_sourceIsUtf16 ? QStringConverter::Utf16 : QStringConverter::Utf8;
 
-    for (const QString &filename : filenames) {
+    // Files found in the cache are not parsed. The files they parsed as
+    // part of themselves are blacklisted like in a real run.
+    struct FileState
+    {
+        Translator cached;
+        bool isCached = false;
+        bool parsed = false;
+        QStringList dependencies;
+        QStringList directIncludes;
+        QString error;
+        ExtractionCache::Diagnostics diagnostics;
+    };
+    QList<FileState> states(filenames.size());
+    FileState *stateData = states.data();
+
+    // The files are parsed in parallel. The headers they include are shared
+    // through CppFiles, and the messages are collected in the order of the
+    // file names afterwards, so the result does not depend on the scheduling.
+    const auto parseFile = [&](qsizetype index) {
+        const QString &filename = filenames.at(index);
+        FileState &state = stateData[index];
+        if (cache && cache->lookup(filename, &state.cached, &state.directIncludes,
+                                   &state.diagnostics)) {
+            state.isCached = true;
+            for (const QString &include : qAsConst(state.directIncludes))
+                CppFiles::setBlacklisted(include);
+            return;
+        }
+
         if (!CppFiles::getResults(filename).isEmpty() || CppFiles::isBlacklisted(filename))
-            continue;
+            return;
 
         QFile file(filename);
         if (!file.open(QIODevice::ReadOnly)) {
-            cd.appendError(QStringLiteral("Cannot open %1: %2").arg(filename,
-                                                                    file.errorString()));
-            continue;
+            state.error = QStringLiteral("Cannot open %1: %2").arg(filename,
+                                                                   file.errorString());
+            return;
         }
 
         CppParser parser;
@@ -2231,16 +2377,62 @@ void loadCPP(Translator &translator, const QStringList &filenames, ConversionDat
         parser.setTranslator(tor);
         QSet<QString> inclusions;
         parser.parse(cd, QStringList(), inclusions);
+        if (cache) {
+            parser.dependencies(&state.dependencies, &state.directIncludes);
+            state.parsed = true;
+        }
         parser.recordResults(isHeader(filename));
+        state.diagnostics.output = QByteArray::fromStdString(parser.diagnostics());
+    };
+
+    if (filenames.size() < 2 || QThread::idealThreadCount() < 2) {
+        for (qsizetype i = 0; i < filenames.size(); ++i)
+            parseFile(i);
+    } else {
+        // The alias table is built on first use, do that before the threads start.
+        trFunctionAliasManager.trFunctionByName(QString());
+
+        QThreadPool pool;
+        // Includes are parsed recursively, give the threads the stack size
+        // the main thread typically has.
+        pool.setStackSize(8 * 1024 * 1024);
+        for (qsizetype i = 0; i < filenames.size(); ++i)
+            pool.start([&parseFile, i] { parseFile(i); });
+        pool.waitForDone();
     }
 
-    for (const QString &filename : filenames) {
-        if (!CppFiles::isBlacklisted(filename)) {
-            if (const Translator *tor = CppFiles::getTranslator(filename)) {
-                for (const TranslatorMessage &msg : tor->messages())
-                    translator.extend(msg, cd);
-            }
+    for (const FileState &state : qAsConst(states)) {
+        std::cerr.write(state.diagnostics.output.constData(), state.diagnostics.output.size());
+        for (const QString &error : state.diagnostics.errors)
+            cd.appendError(error);
+        if (!state.error.isEmpty())
+            cd.appendError(state.error);
+    }
+
+    const Translator noMessages;
+    for (qsizetype i = 0; i < filenames.size(); ++i) {
+        const QString &filename = filenames.at(i);
+        FileState &state = states[i];
+        if (CppFiles::isBlacklisted(filename))
+            continue;
+        const Translator *tor = state.isCached ? &state.cached
+                                               : CppFiles::getTranslator(filename);
+        if (tor) {
+            for (const TranslatorMessage &msg : tor->messages())
+                translator.extend(msg, cd);
+        }
+
+        if (!cache || state.isCached || !state.error.isEmpty())
+            continue;
+        // Headers included by a file parsed before them are not parsed again.
+        if (!state.parsed) {
+            const QSet<const ParseResults *> rslts = CppFiles::getResults(filename);
+            if (rslts.isEmpty())
+                continue;
+            collectDependencies(rslts, &state.dependencies, &state.directIncludes);
         }
+        cache->insert(filename, state.dependencies, tor ? *tor : noMessages,
+                      state.directIncludes, state.diagnostics);
     }
 }
 
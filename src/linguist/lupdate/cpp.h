@@ -6,30 +6,47 @@
 
 #include "lupdate.h"
 
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 
 #include <iostream>
 
 QT_BEGIN_NAMESPACE
 
+// The hashes are computed up front, as the strings are shared between
+// the threads parsing different files.
 struct HashString {
-    HashString() : m_hash(0x80000000) {}
-    explicit HashString(const QString &str) : m_str(str), m_hash(0x80000000) {}
-    void setValue(const QString &str) { m_str = str; m_hash = 0x80000000; }
+    HashString() : m_hash(hashValue(QString())) {}
+    explicit HashString(const QString &str) : m_str(str), m_hash(hashValue(str)) {}
+    void setValue(const QString &str) { m_str = str; m_hash = hashValue(str); }
     const QString &value() const { return m_str; }
     bool operator==(const HashString &other) const { return m_str == other.m_str; }
     QString m_str;
 
-    mutable uint m_hash; // We use the highest bit as a validity indicator (set => invalid)
+    size_t m_hash;
+
+private:
+    static size_t hashValue(const QString &str) { return qHash(str); }
 };
 
 struct HashStringList {
-    explicit HashStringList(const QList<HashString> &list) : m_list(list), m_hash(0x80000000) {}
+    explicit HashStringList(const QList<HashString> &list) : m_list(list), m_hash(hashValue(list)) {}
     const QList<HashString> &value() const { return m_list; }
     bool operator==(const HashStringList &other) const { return m_list == other.m_list; }
 
     QList<HashString> m_list;
-    mutable uint m_hash; // We use the highest bit as a validity indicator (set => invalid)
+    size_t m_hash;
+
+private:
+    static size_t hashValue(const QList<HashString> &list)
+    {
+        size_t hash = 0;
+        for (const HashString &qs : list) {
+            hash ^= qs.m_hash ^ 0x6ad9f526;
+            hash = ((hash << 13) & 0x7fffffff) | (hash >> 18);
+        }
+        return hash;
+    }
 };
 
 typedef QList<HashString> NamespaceList;
@@ -72,6 +89,8 @@ struct ParseResults {
     int fileId;
     Namespace rootNamespace;
     QSet<const ParseResults *> includes;
+    QSet<QString> fileNames; // The files read or included, for the extraction cache
+    QSet<QString> directIncludes; // The included files parsed as part of this file
 };
 
 struct IncludeCycle {
@@ -82,20 +101,25 @@ struct IncludeCycle {
 typedef QHash<QString, IncludeCycle *> IncludeCycleHash;
 typedef QHash<QString, const Translator *> TranslatorHash;
 
+// The results of the files parsed so far, shared between the threads
+// parsing the files passed to loadCPP().
 class CppFiles {
 
 public:
     static QSet<const ParseResults *> getResults(const QString &cleanFile);
-    static void setResults(const QString &cleanFile, const ParseResults *results);
     static const Translator *getTranslator(const QString &cleanFile);
-    static void setTranslator(const QString &cleanFile, const Translator *results);
+    static int publications(const QString &cleanFile);
+    static bool publish(const QString &cleanFile, int publications,
+                        const ParseResults *results, const Translator *tor);
     static bool isBlacklisted(const QString &cleanFile);
     static void setBlacklisted(const QString &cleanFile);
     static void addIncludeCycle(const QSet<QString> &fileNames);
 
 private:
+    static QMutex &mutex();
     static IncludeCycleHash &includeCycles();
     static TranslatorHash &translatedFiles();
+    static QHash<QString, int> &publishedFiles();
     static QSet<QString> &blacklistedFiles();
 };
 
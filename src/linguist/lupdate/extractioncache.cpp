@@ -0,0 +1,225 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "extractioncache.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+static const quint32 cacheMagic = 0x4c555043; // "LUPC"
+static const quint32 cacheVersion = 2;
+
+static QDataStream &operator<<(QDataStream &s, const TranslatorMessage &msg)
+{
+    QList<QPair<QString, qint32>> references;
+    for (const TranslatorMessage::Reference &ref : msg.allReferences())
+        references.append(qMakePair(ref.fileName(), qint32(ref.lineNumber())));
+    return s << msg.id() << msg.context() << msg.sourceText() << msg.oldSourceText()
+             << msg.comment() << msg.oldComment() << msg.userData() << msg.extras()
+             << msg.extraComment() << msg.translatorComment() << msg.warning()
+             << msg.translations() << references << qint32(msg.type()) << msg.isPlural()
+             << msg.warningOnly();
+}
+
+static QDataStream &operator>>(QDataStream &s, TranslatorMessage &msg)
+{
+    QString id, context, sourceText, oldSourceText, comment, oldComment, userData;
+    QString extraComment, translatorComment, warning;
+    TranslatorMessage::ExtraData extras;
+    QStringList translations;
+    QList<QPair<QString, qint32>> references;
+    qint32 type;
+    bool plural, warningOnly;
+    s >> id >> context >> sourceText >> oldSourceText >> comment >> oldComment >> userData
+      >> extras >> extraComment >> translatorComment >> warning >> translations >> references
+      >> type >> plural >> warningOnly;
+
+    msg = TranslatorMessage(context, sourceText, comment, userData, QString(), -1,
+                            translations, TranslatorMessage::Type(type), plural);
+    msg.setId(id);
+    msg.setOldSourceText(oldSourceText);
+    msg.setOldComment(oldComment);
+    msg.setExtras(extras);
+    msg.setExtraComment(extraComment);
+    msg.setTranslatorComment(translatorComment);
+    msg.setWarning(warning);
+    msg.setWarningOnly(warningOnly);
+    TranslatorMessage::References refs;
+    for (const auto &ref : qAsConst(references))
+        refs.append(TranslatorMessage::Reference(ref.first, ref.second));
+    msg.setReferences(refs);
+    return s;
+}
+
+/*
+    The options that influence what is extracted from a file are part of
+    the key. The set of all source files, which is used to resolve some
+    includes, is deliberately not, as adding a file would invalidate the
+    whole cache.
+*/
+ExtractionCache::ExtractionCache(const QString &directory, const ConversionData &cd)
+{
+    QStringList projectRoots = cd.m_projectRoots.values();
+    projectRoots.sort();
+
+    QDataStream s(&m_key, QIODevice::WriteOnly);
+    s << QByteArray(QT_VERSION_STR) << cd.m_sourceIsUtf16 << cd.m_noUiLines
+      << cd.m_includePath << cd.m_excludes << projectRoots
+      << trFunctionAliasManager.availableFunctionsWithAliases();
+
+    m_fileName = directory + QLatin1Char('/')
+            + QLatin1String(QCryptographicHash::hash(m_key, QCryptographicHash::Sha1).toHex())
+            + QLatin1String(".lupdatecache");
+    load();
+}
+
+void ExtractionCache::load()
+{
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream s(&file);
+    s.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray key;
+    s >> magic >> version >> key;
+    if (magic != cacheMagic || version != cacheVersion || key != m_key)
+        return;
+
+    QHash<QString, Entry> entries;
+    qint32 count = 0;
+    s >> count;
+    for (qint32 i = 0; i < count && s.status() == QDataStream::Ok; ++i) {
+        QString fileName;
+        Entry entry;
+        s >> fileName >> entry.dependencies >> entry.directIncludes >> entry.extras
+          >> entry.messages >> entry.diagnostics.output >> entry.diagnostics.errors;
+        entries.insert(fileName, entry);
+    }
+    if (s.status() == QDataStream::Ok)
+        m_entries = entries;
+}
+
+/*
+    Returns the hash of the contents of \a fileName, or an empty array
+    if the file cannot be read. Missing files are recorded as dependencies
+    as well, as they might be found once they exist.
+*/
+QByteArray ExtractionCache::contentHash(const QString &fileName)
+{
+    {
+        QMutexLocker locker(&m_hashMutex);
+        const auto it = m_contentHashes.constFind(fileName);
+        if (it != m_contentHashes.cend())
+            return *it;
+    }
+
+    QByteArray hash;
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadOnly)) {
+        QCryptographicHash hasher(QCryptographicHash::Sha1);
+        if (hasher.addData(&file))
+            hash = hasher.result();
+    }
+
+    QMutexLocker locker(&m_hashMutex);
+    m_contentHashes.insert(fileName, hash);
+    return hash;
+}
+
+/*
+    Fills \a tor with the messages cached for \a fileName and returns true,
+    if neither the file nor its dependencies changed. \a directIncludes
+    receives the files that were parsed as part of the file, and
+    \a diagnostics what parsing it printed and reported.
+
+    May be called from several threads at once, unlike insert() and save().
+*/
+bool ExtractionCache::lookup(const QString &fileName, Translator *tor, QStringList *directIncludes,
+                             Diagnostics *diagnostics)
+{
+    const auto it = m_entries.constFind(fileName);
+    if (it == m_entries.cend())
+        return false;
+
+    for (const auto &dependency : it->dependencies) {
+        if (contentHash(dependency.first) != dependency.second)
+            return false;
+    }
+
+    for (const TranslatorMessage &msg : it->messages)
+        tor->append(msg);
+    tor->setExtras(it->extras);
+    if (directIncludes)
+        *directIncludes = it->directIncludes;
+    if (diagnostics)
+        *diagnostics = it->diagnostics;
+    return true;
+}
+
+void ExtractionCache::insert(const QString &fileName, const QStringList &dependencies,
+                             const Translator &tor, const QStringList &directIncludes,
+                             const Diagnostics &diagnostics)
+{
+    Entry entry;
+    for (const QString &dependency : dependencies)
+        entry.dependencies.append(qMakePair(dependency, contentHash(dependency)));
+    entry.directIncludes = directIncludes;
+    entry.extras = tor.extras();
+    entry.messages = tor.messages();
+    entry.diagnostics = diagnostics;
+    m_entries.insert(fileName, entry);
+    m_modified = true;
+}
+
+bool ExtractionCache::save(QString *errorString)
+{
+    if (!m_modified)
+        return true;
+
+    // Forget about files that were removed in the meantime.
+    for (auto it = m_entries.begin(); it != m_entries.end(); ) {
+        if (QFileInfo::exists(it.key()))
+            ++it;
+        else
+            it = m_entries.erase(it);
+    }
+
+    if (!QDir().mkpath(QFileInfo(m_fileName).absolutePath())) {
+        *errorString = QStringLiteral("Cannot create directory %1")
+                .arg(QFileInfo(m_fileName).absolutePath());
+        return false;
+    }
+
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        *errorString = QStringLiteral("Cannot write %1: %2").arg(m_fileName, file.errorString());
+        return false;
+    }
+
+    QDataStream s(&file);
+    s.setVersion(QDataStream::Qt_6_0);
+    s << cacheMagic << cacheVersion << m_key << qint32(m_entries.size());
+    for (auto it = m_entries.cbegin(), end = m_entries.cend(); it != end; ++it) {
+        s << it.key() << it->dependencies << it->directIncludes << it->extras
+          << it->messages << it->diagnostics.output << it->diagnostics.errors;
+    }
+    if (s.status() != QDataStream::Ok || !file.commit()) {
+        *errorString = QStringLiteral("Cannot write %1: %2").arg(m_fileName, file.errorString());
+        return false;
+    }
+    m_modified = false;
+    return true;
+}
+
+QT_END_NAMESPACE
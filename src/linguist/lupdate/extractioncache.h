@@ -0,0 +1,68 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef EXTRACTIONCACHE_H
+#define EXTRACTIONCACHE_H
+
+#include "lupdate.h"
+
+#include <translator.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+QT_BEGIN_NAMESPACE
+
+// Stores the messages extracted from each source file in a directory, so
+// that later runs only need to parse the files that changed. An entry is
+// valid as long as the contents of the file and of all the files it depends
+// on (the included headers) are unchanged. The options affecting the
+// extraction select the cache file.
+class ExtractionCache
+{
+public:
+    // What parsing a file printed and reported as errors. It is repeated
+    // when the file is taken from the cache.
+    struct Diagnostics
+    {
+        QByteArray output;
+        QStringList errors;
+    };
+
+    ExtractionCache(const QString &directory, const ConversionData &cd);
+
+    bool lookup(const QString &fileName, Translator *tor, QStringList *directIncludes = nullptr,
+                Diagnostics *diagnostics = nullptr);
+    void insert(const QString &fileName, const QStringList &dependencies, const Translator &tor,
+                const QStringList &directIncludes = QStringList(),
+                const Diagnostics &diagnostics = Diagnostics());
+    bool save(QString *errorString);
+
+private:
+    struct Entry
+    {
+        QList<QPair<QString, QByteArray>> dependencies;
+        QStringList directIncludes;
+        Translator::ExtraData extras;
+        QList<TranslatorMessage> messages;
+        Diagnostics diagnostics;
+    };
+
+    QByteArray contentHash(const QString &fileName);
+    void load();
+
+    QString m_fileName;
+    QByteArray m_key;
+    QHash<QString, Entry> m_entries;
+    bool m_modified = false;
+
+    QMutex m_hashMutex;
+    QHash<QString, QByteArray> m_contentHashes;
+};
+
+QT_END_NAMESPACE
+
+#endif // EXTRACTIONCACHE_H
@@ -2,6 +2,7 @@
 // Copyright (C) 2016 Klarälvdalens Datakonsult AB, a KDAB Group company, info@kdab.com, author Marc Mutz <marc.mutz@kdab.com>
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
+#include "extractioncache.h"
 #include "lupdate.h"
 #if QT_CONFIG(clangcpp)
 #include "cpp_clang.h"
@@ -18,11 +19,13 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QLibraryInfo>
+#include <QtCore/QScopedPointer>
 #include <QtCore/QString>
 #include <QtCore/QStringList>
 #include <QtCore/QTranslator>
 
 #include <iostream>
+#include <sstream>
 
 using namespace Qt::StringLiterals;
 
@@ -188,6 +191,7 @@ QString ParserTool::transcode(const QString &str)
 }
 
 static QString m_defaultExtensions;
+static QString m_cacheDirectory;
 
 static void printOut(const QString & out)
 {
@@ -249,6 +253,10 @@ static void printUsage()
         "           Default is absolute for new files.\n"
         "    -no-ui-lines\n"
         "           Do not record line numbers in references to UI files.\n"
+        "    -cache-dir <directory>\n"
+        "           Cache the messages extracted from each source file in <directory>.\n"
+        "           Subsequent runs only parse the files that changed or include changed\n"
+        "           files. Not used with -clang-parser.\n"
         "    -disable-heuristic {sametext|similartext|number}\n"
         "           Disable the named merge heuristic. Can be specified multiple times.\n"
         "    -project <filename>\n"
@@ -476,6 +484,42 @@ static QStringList getResources(const QString &resourceFile)
     return rqr.files;
 }
 
+// Runs \a load for \a sourceFile, or takes the messages from \a cache if
+// the file did not change. What the loader printed and reported as errors
+// is kept in the cache and repeated for cached files.
+template <typename Loader>
+static void loadCached(ExtractionCache *cache, Translator &fetchedTor, const QString &sourceFile,
+                       ConversionData &cd, Loader load)
+{
+    if (!cache) {
+        load(fetchedTor, sourceFile, cd);
+        return;
+    }
+    Translator tor;
+    ExtractionCache::Diagnostics diagnostics;
+    if (cache->lookup(sourceFile, &tor, nullptr, &diagnostics)) {
+        std::cerr.write(diagnostics.output.constData(), diagnostics.output.size());
+        for (const QString &error : qAsConst(diagnostics.errors))
+            cd.appendError(error);
+    } else {
+        const qsizetype errorCount = cd.errors().size();
+        std::ostringstream output;
+        std::streambuf *errorBuffer = std::cerr.rdbuf(output.rdbuf());
+        const bool loaded = load(tor, sourceFile, cd);
+        std::cerr.rdbuf(errorBuffer);
+        std::cerr << output.str();
+        if (!loaded)
+            return;
+        diagnostics.output = QByteArray::fromStdString(output.str());
+        diagnostics.errors = cd.errors().mid(errorCount);
+        cache->insert(sourceFile, QStringList(sourceFile), tor, QStringList(), diagnostics);
+    }
+    for (const TranslatorMessage &msg : tor.messages())
+        fetchedTor.extend(msg, cd);
+    if (!tor.extras().isEmpty())
+        fetchedTor.setExtras(tor.extras());
+}
+
 static bool processTs(Translator &fetchedTor, const QString &file, ConversionData &cd)
 {
     for (const Translator::FileFormat &fmt : qAsConst(Translator::registeredFileFormats())) {
@@ -501,19 +545,23 @@ static void processSources(Translator &fetchedTor,
 #ifdef QT_NO_QML
     bool requireQmlSupport = false;
 #endif
+    QScopedPointer<ExtractionCache> cache;
+    if (!m_cacheDirectory.isEmpty())
+        cache.reset(new ExtractionCache(m_cacheDirectory, cd));
+
     QStringList sourceFilesCpp;
     for (const auto &sourceFile : sourceFiles) {
         if (sourceFile.endsWith(QLatin1String(".java"), Qt::CaseInsensitive))
-            loadJava(fetchedTor, sourceFile, cd);
+            loadCached(cache.data(), fetchedTor, sourceFile, cd, loadJava);
         else if (sourceFile.endsWith(QLatin1String(".ui"), Qt::CaseInsensitive)
                  || sourceFile.endsWith(QLatin1String(".jui"), Qt::CaseInsensitive))
-            loadUI(fetchedTor, sourceFile, cd);
+            loadCached(cache.data(), fetchedTor, sourceFile, cd, loadUI);
 #ifndef QT_NO_QML
         else if (sourceFile.endsWith(QLatin1String(".js"), Qt::CaseInsensitive)
                  || sourceFile.endsWith(QLatin1String(".qs"), Qt::CaseInsensitive))
-            loadQScript(fetchedTor, sourceFile, cd);
+            loadCached(cache.data(), fetchedTor, sourceFile, cd, loadQScript);
         else if (sourceFile.endsWith(QLatin1String(".qml"), Qt::CaseInsensitive))
-            loadQml(fetchedTor, sourceFile, cd);
+            loadCached(cache.data(), fetchedTor, sourceFile, cd, loadQml);
 #else
         else if (sourceFile.endsWith(QLatin1String(".qml"), Qt::CaseInsensitive)
                  || sourceFile.endsWith(QLatin1String(".js"), Qt::CaseInsensitive)
@@ -521,7 +569,7 @@ static void processSources(Translator &fetchedTor,
             requireQmlSupport = true;
 #endif // QT_NO_QML
         else if (sourceFile.endsWith(u".py", Qt::CaseInsensitive))
-            loadPython(fetchedTor, sourceFile, cd);
+            loadCached(cache.data(), fetchedTor, sourceFile, cd, loadPython);
         else if (!processTs(fetchedTor, sourceFile, cd))
             sourceFilesCpp << sourceFile;
     }
@@ -540,10 +588,14 @@ static void processSources(Translator &fetchedTor,
 #endif
     }
     else
-        loadCPP(fetchedTor, sourceFilesCpp, cd);
+        loadCPP(fetchedTor, sourceFilesCpp, cd, cache.data());
 
     if (!cd.error().isEmpty())
         printErr(cd.error());
+
+    QString errorString;
+    if (cache && !cache->save(&errorString))
+        printErr(QStringLiteral("lupdate warning: %1\n").arg(errorString));
 }
 
 static QSet<QString> projectRoots(const QString &projectFile, const QStringList &sourceFiles)
@@ -795,6 +847,14 @@ int main(int argc, char **argv)
                 return 1;
             }
             continue;
+        } else if (arg == QLatin1String("-cache-dir")) {
+            ++i;
+            if (i == argc) {
+                printErr(u"The -cache-dir option should be followed by a directory name.\n"_s);
+                return 1;
+            }
+            m_cacheDirectory = args[i];
+            continue;
         } else if (arg == QLatin1String("-no-ui-lines")) {
             options |= NoUiLines;
             continue;
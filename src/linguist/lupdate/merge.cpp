@@ -420,6 +420,7 @@ Translator merge(
       Messages found only in the virgin translator are added to the
       vernacular translator.
     */
+    QList<TranslatorMessage> newMessages;
     for (const TranslatorMessage &mv : virginTor.messages()) {
         if (mv.sourceText().isEmpty() && mv.id().isEmpty()) {
             if (tor.find(mv.context()) >= 0)
@@ -443,10 +444,11 @@ Translator merge(
         if (options & NoLocations)
             outTor.append(mv);
         else
-            outTor.appendSorted(mv);
+            newMessages.append(mv);
         if (!mv.sourceText().isEmpty() || !mv.id().isEmpty())
             ++neww;
     }
+    outTor.appendSorted(newMessages);
 
     /*
       "Alien" translators can be used to augment the vernacular translator.
@@ -7,6 +7,9 @@
 #include <QtCore/QByteArray>
 #include <QtCore/QString>
 #include <QtCore/QList>
+#include <QtCore/qalgorithms.h>
+
+#include <algorithm>
 
 
 QT_BEGIN_NAMESPACE
@@ -71,29 +74,6 @@ static const int indexOf[256] = {
     15, 12, 16, 17, 18, 19, 2,  10, 15, 7,  19, 2,  6,  7,  10, 0
 };
 
-/*
-  The entry bitCount[i] (for i between 0 and 255) is the number of bits used to
-  represent i in binary.
-*/
-static const int bitCount[256] = {
-    0,  1,  1,  2,  1,  2,  2,  3,  1,  2,  2,  3,  2,  3,  3,  4,
-    1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,
-    1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,
-    1,  2,  2,  3,  2,  3,  3,  4,  2,  3,  3,  4,  3,  4,  4,  5,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,
-    2,  3,  3,  4,  3,  4,  4,  5,  3,  4,  4,  5,  4,  5,  5,  6,
-    3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,
-    3,  4,  4,  5,  4,  5,  5,  6,  4,  5,  5,  6,  5,  6,  6,  7,
-    4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8
-};
-
 static inline void setCoOccurence(CoMatrix &m, char c, char d)
 {
     int k = indexOf[(uchar) c] + 20 * indexOf[(uchar) d];
@@ -119,84 +99,120 @@ CoMatrix::CoMatrix(const QString &str)
     }
 }
 
-static inline int worth(const CoMatrix &m)
+/*
+  The score is the number of bits set in both matrices over the number of bits
+  set in either of them, adjusted for the difference in length.
+*/
+static inline int similarityScore(const CoMatrix &m, int mLength, const CoMatrix &n, int nLength)
 {
-    int w = 0;
-    for (int i = 0; i < 50; i++)
-        w += bitCount[m.b[i]];
-    return w;
+    int common = 0;
+    int all = 0;
+    for (int i = 0; i < 13; ++i) {
+        common += qPopulationCount(m.w[i] & n.w[i]);
+        all += qPopulationCount(m.w[i] | n.w[i]);
+    }
+    int delta = qAbs(mLength - nLength);
+    return ((common + 1) << 10) / (all + (delta << 1) + 1);
 }
 
-static inline CoMatrix reunion(const CoMatrix &m, const CoMatrix &n)
+StringSimilarityMatcher::StringSimilarityMatcher(const QString &stringToMatch)
+    : m_cm(stringToMatch)
 {
-    CoMatrix p;
-    for (int i = 0; i < 13; ++i)
-        p.w[i] = m.w[i] | n.w[i];
-    return p;
+    m_length = stringToMatch.length();
 }
 
-static inline CoMatrix intersection(const CoMatrix &m, const CoMatrix &n)
+int StringSimilarityMatcher::getSimilarityScore(const QString &strCandidate)
 {
-    CoMatrix p;
-    for (int i = 0; i < 13; ++i)
-        p.w[i] = m.w[i] & n.w[i];
-    return p;
+    return similarityScore(m_cm, m_length, CoMatrix(strCandidate), strCandidate.size());
 }
 
-StringSimilarityMatcher::StringSimilarityMatcher(const QString &stringToMatch)
-    : m_cm(stringToMatch)
+void SimilarTextIndex::resize(int count)
 {
-    m_length = stringToMatch.length();
+    m_fingerprints.resize(count);
+    m_candidates.resize(count);
 }
 
-int StringSimilarityMatcher::getSimilarityScore(const QString &strCandidate)
+void SimilarTextIndex::setCandidate(int i, const Candidate &candidate)
 {
-    CoMatrix cmTarget(strCandidate);
-    int delta = qAbs(m_length - strCandidate.size());
-    int score = ( (worth(intersection(m_cm, cmTarget)) + 1) << 10 ) /
-        ( worth(reunion(m_cm, cmTarget)) + (delta << 1) + 1 );
-    return score;
+    m_fingerprints[i].cm = CoMatrix(candidate.source);
+    m_fingerprints[i].length = candidate.source.size();
+    m_candidates[i] = candidate;
 }
 
-CandidateList similarTextHeuristicCandidates(const Translator *tor,
-    const QString &text, int maxCandidates)
+void SimilarTextIndex::removeCandidate(int i)
 {
-    QList<int> scores;
-    CandidateList candidates;
-    StringSimilarityMatcher matcher(text);
+    m_fingerprints[i].length = -1;
+    m_candidates[i] = Candidate();
+}
 
-    for (const TranslatorMessage &mtm : tor->messages()) {
-        if (mtm.type() == TranslatorMessage::Unfinished
-            || mtm.translation().isEmpty())
+/*
+  Returns up to maxCandidates distinct candidates that score at least
+  textSimilarityThreshold against text, best first. Equally scored candidates
+  are returned in index order.
+*/
+CandidateList SimilarTextIndex::candidates(const QString &text, int maxCandidates) const
+{
+    if (maxCandidates <= 0)
+        return CandidateList();
+
+    struct Hit {
+        int score;
+        int index;
+    };
+    // The best hits are kept in a heap with the weakest one on top.
+    const auto better = [](const Hit &a, const Hit &b) {
+        return a.score > b.score || (a.score == b.score && a.index < b.index);
+    };
+    QList<Hit> hits;
+    hits.reserve(maxCandidates);
+
+    const CoMatrix cm(text);
+    const int length = text.size();
+    const Fingerprint *fingerprints = m_fingerprints.constData();
+    for (int i = 0, n = m_fingerprints.size(); i < n; ++i) {
+        const Fingerprint &fp = fingerprints[i];
+        if (fp.length < 0)
             continue;
-
-        QString s = mtm.sourceText();
-        int score = matcher.getSimilarityScore(s);
-
-        if (candidates.size() == maxCandidates && score > scores[maxCandidates - 1] )
-            candidates.removeLast();
-
-        if (candidates.size() < maxCandidates && score >= textSimilarityThreshold) {
-            Candidate cand(mtm.context(), s, mtm.comment(), mtm.translation());
-
-            int i;
-            for (i = 0; i < candidates.size(); i++) {
-                if (score >= scores.at(i)) {
-                    if (score == scores.at(i)) {
-                        if (candidates.at(i) == cand)
-                            goto continue_outer_loop;
-                    } else {
-                        break;
-                    }
-                }
-            }
-            scores.insert(i, score);
-            candidates.insert(i, cand);
+        const Hit hit = { similarityScore(cm, length, fp.cm, fp.length), i };
+        if (hit.score < textSimilarityThreshold)
+            continue;
+        if (hits.size() == maxCandidates && !better(hit, hits.constFirst()))
+            continue;
+        // The score only depends on the source, so duplicates score the same.
+        const auto duplicate = [&](const Hit &h) {
+            return h.score == hit.score && m_candidates.at(h.index) == m_candidates.at(i);
+        };
+        if (std::any_of(hits.cbegin(), hits.cend(), duplicate))
+            continue;
+        if (hits.size() == maxCandidates) {
+            std::pop_heap(hits.begin(), hits.end(), better);
+            hits.removeLast();
         }
-        continue_outer_loop:
-        ;
+        hits.append(hit);
+        std::push_heap(hits.begin(), hits.end(), better);
     }
+    std::sort_heap(hits.begin(), hits.end(), better);
+
+    CandidateList candidates;
+    candidates.reserve(hits.size());
+    for (const Hit &hit : qAsConst(hits))
+        candidates.append(m_candidates.at(hit.index));
     return candidates;
 }
 
+CandidateList similarTextHeuristicCandidates(const Translator *tor,
+    const QString &text, int maxCandidates)
+{
+    SimilarTextIndex index;
+    index.resize(tor->messageCount());
+    int i = 0;
+    for (const TranslatorMessage &mtm : tor->messages()) {
+        if (mtm.type() != TranslatorMessage::Unfinished && !mtm.translation().isEmpty())
+            index.setCandidate(i, Candidate(mtm.context(), mtm.sourceText(), mtm.comment(),
+                                            mtm.translation()));
+        ++i;
+    }
+    return index.candidates(text, maxCandidates);
+}
+
 QT_END_NAMESPACE
@@ -67,6 +67,30 @@ private:
     int m_length;
 };
 
+/**
+ * Keeps the CoMatrix of every candidate in one contiguous array, so a text
+ * can be matched against all of them without building any matrix but its
+ * own. Single entries can be replaced when the candidates change.
+ * \sa similarTextHeuristicCandidates
+ */
+class SimilarTextIndex {
+public:
+    int count() const { return m_fingerprints.size(); }
+    void resize(int count);
+    void setCandidate(int i, const Candidate &candidate);
+    void removeCandidate(int i);
+    CandidateList candidates(const QString &text, int maxCandidates) const;
+
+private:
+    struct Fingerprint {
+        CoMatrix cm;
+        int length = -1; // -1 if there is no candidate at this position
+    };
+
+    QList<Fingerprint> m_fingerprints;
+    QList<Candidate> m_candidates;
+};
+
 /**
  * Checks how similar two strings are.
  * The return value is the score, and a higher score is more similar
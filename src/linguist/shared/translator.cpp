@@ -28,7 +28,8 @@ QT_BEGIN_NAMESPACE
 
 Translator::Translator() :
     m_locationsType(AbsoluteLocations),
-    m_indexOk(true)
+    m_indexOk(true),
+    m_refIndexOk(false)
 {
 }
 
@@ -59,6 +60,10 @@ void Translator::addIndex(int idx, const TranslatorMessage &msg) const
         if (!msg.id().isEmpty())
             m_idMsgIdx[msg.id()] = idx;
     }
+    if (m_refIndexOk) {
+        for (const TranslatorMessage::Reference &ref : msg.allReferences())
+            m_refIdx.insert(ref, idx);
+    }
 }
 
 void Translator::delIndex(int idx) const
@@ -77,6 +82,7 @@ void Translator::ensureIndexed() const
 {
     if (!m_indexOk) {
         m_indexOk = true;
+        m_refIndexOk = false;
         m_ctxCmtIdx.clear();
         m_idMsgIdx.clear();
         m_msgIdx.clear();
@@ -136,6 +142,8 @@ void Translator::extend(const TranslatorMessage &msg, ConversionData &cd)
             return;
         }
         emsg.addReferenceUniq(msg.fileName(), msg.lineNumber());
+        if (m_refIndexOk && !msg.fileName().isEmpty())
+            m_refIdx.insert(TranslatorMessage::Reference(msg.fileName(), msg.lineNumber()), index);
         if (!msg.extraComment().isEmpty()) {
             QString cmt = emsg.extraComment();
             if (!cmt.isEmpty()) {
@@ -170,61 +178,192 @@ void Translator::append(const TranslatorMessage &msg)
 
 void Translator::appendSorted(const TranslatorMessage &msg)
 {
-    int msgLine = msg.lineNumber();
-    if (msgLine < 0) {
+    if (msg.lineNumber() < 0) {
         append(msg);
         return;
     }
+    appendSorted(QList<TranslatorMessage>() << msg);
+}
+
+namespace {
+
+// The messages sharing a file name and context, in the order of m_messages.
+// Only these take part in choosing the insertion point of a message; any
+// other message merely separates two regions.
+struct SortedGroup
+{
+    struct Entry {
+        int lineNumber;
+        int node;
+        bool adjacent; // whether the preceding message is the previous entry
+    };
+    QList<Entry> entries;
+};
+
+using SortedGroupKey = QPair<QString, QString>;
+
+SortedGroupKey sortedGroupKey(const TranslatorMessage &msg)
+{
+    return qMakePair(msg.fileName(), msg.context());
+}
+
+} // namespace
 
-    int bestIdx = 0; // Best insertion point found so far
-    int bestScore = 0; // Its category: 0 = no hit, 1 = pre or post, 2 = middle
-    int bestSize = 0; // The length of the region. Longer is better within one category.
-
-    // The insertion point to use should this region turn out to be the best one so far
-    int thisIdx = 0;
-    int thisScore = 0;
-    int thisSize = 0;
-    // Working vars
-    int prevLine = 0;
-    int curIdx = 0;
-    for (const TranslatorMessage &mit : qAsConst(m_messages)) {
-        bool sameFile = mit.fileName() == msg.fileName() && mit.context() == msg.context();
-        int curLine;
-        if (sameFile && (curLine = mit.lineNumber()) >= prevLine) {
-            if (msgLine >= prevLine && msgLine < curLine) {
-                thisIdx = curIdx;
-                thisScore = thisSize ? 2 : 1;
+// Equivalent to calling appendSorted() for every message in turn, but the
+// messages are placed by looking only at the ones from the same file and
+// context, and m_messages and its index are rebuilt once, starting at the
+// first position that changed.
+void Translator::appendSorted(const QList<TranslatorMessage> &msgs)
+{
+    if (msgs.isEmpty())
+        return;
+
+    QHash<SortedGroupKey, SortedGroup> groups;
+    for (const TranslatorMessage &msg : msgs)
+        groups.insert(sortedGroupKey(msg), SortedGroup());
+
+    // The final order is kept as a doubly linked list of nodes. The nodes
+    // below count() are the existing messages, the others index into msgs.
+    const int count = m_messages.count();
+    QList<int> next(count + msgs.count(), -1);
+    QList<int> prev(count + msgs.count(), -1);
+    int head = count ? 0 : -1;
+    int tail = count - 1;
+    SortedGroupKey tailKey;
+    for (int i = 0; i < count; ++i) {
+        next[i] = i + 1 < count ? i + 1 : -1;
+        prev[i] = i - 1;
+        const SortedGroupKey key = sortedGroupKey(m_messages.at(i));
+        auto it = groups.find(key);
+        if (it != groups.end()) {
+            QList<SortedGroup::Entry> &entries = it->entries;
+            const bool adjacent = !entries.isEmpty() && entries.constLast().node == i - 1;
+            entries.append(SortedGroup::Entry{ m_messages.at(i).lineNumber(), i, adjacent });
+        }
+        if (i == count - 1)
+            tailKey = key;
+    }
+
+    auto linkAfter = [&](int node, int after) {
+        prev[node] = after;
+        next[node] = next[after];
+        if (next[after] >= 0)
+            prev[next[after]] = node;
+        else
+            tail = node;
+        next[after] = node;
+    };
+    auto linkBefore = [&](int node, int before) {
+        next[node] = before;
+        prev[node] = prev[before];
+        if (prev[before] >= 0)
+            next[prev[before]] = node;
+        else
+            head = node;
+        prev[before] = node;
+    };
+
+    for (int m = 0; m < msgs.count(); ++m) {
+        const TranslatorMessage &msg = msgs.at(m);
+        const int node = count + m;
+        const SortedGroupKey key = sortedGroupKey(msg);
+        QList<SortedGroup::Entry> &entries = groups[key].entries;
+        const int msgLine = msg.lineNumber();
+
+        // Find the best region of consecutive entries with ascending line
+        // numbers: preferably one the message fits into, otherwise one it
+        // can be put in front of or after, the longer the better. An
+        // insertion point is the index of the entry to insert before, or the
+        // negated index of the entry to insert after, minus one.
+        int bestIdx = 0;
+        int bestScore = 0;
+        int bestSize = 0;
+        int thisIdx = 0;
+        int thisScore = 0;
+        int thisSize = 0;
+        int prevLine = 0;
+        auto endRegion = [&](int lastEntry) {
+            if (!thisScore) {
+                thisIdx = -lastEntry - 1;
+                thisScore = 1;
             }
-            ++thisSize;
-            prevLine = curLine;
-        } else {
-            if (thisSize) {
-                if (!thisScore) {
-                    thisIdx = curIdx;
-                    thisScore = 1;
+            if (thisScore > bestScore || (thisScore == bestScore && thisSize > bestSize)) {
+                bestIdx = thisIdx;
+                bestScore = thisScore;
+                bestSize = thisSize;
+            }
+            thisScore = 0;
+        };
+        if (msgLine >= 0) {
+            for (int i = 0; i < entries.count(); ++i) {
+                const SortedGroup::Entry &entry = entries.at(i);
+                if (!entry.adjacent && thisSize) {
+                    endRegion(i - 1);
+                    thisSize = 0;
+                    prevLine = 0;
                 }
-                if (thisScore > bestScore || (thisScore == bestScore && thisSize > bestSize)) {
-                    bestIdx = thisIdx;
-                    bestScore = thisScore;
-                    bestSize = thisSize;
+                if (entry.lineNumber >= prevLine) {
+                    if (msgLine >= prevLine && msgLine < entry.lineNumber) {
+                        thisIdx = i;
+                        thisScore = thisSize ? 2 : 1;
+                    }
+                    ++thisSize;
+                    prevLine = entry.lineNumber;
+                } else if (thisSize) {
+                    endRegion(i - 1);
+                    thisSize = 1;
+                    prevLine = 0;
                 }
-                thisScore = 0;
-                thisSize = sameFile ? 1 : 0;
-                prevLine = 0;
             }
+            if (thisSize)
+                endRegion(entries.count() - 1);
+        }
+
+        if (!bestScore) {
+            const bool adjacent = tailKey == key && !entries.isEmpty();
+            entries.append(SortedGroup::Entry{ msgLine, node, adjacent });
+            if (tail >= 0) {
+                linkAfter(node, tail);
+            } else {
+                head = tail = node;
+            }
+            tailKey = key;
+        } else if (bestIdx >= 0) {
+            SortedGroup::Entry &before = entries[bestIdx];
+            const bool adjacent = before.adjacent;
+            before.adjacent = true;
+            linkBefore(node, before.node);
+            entries.insert(bestIdx, SortedGroup::Entry{ msgLine, node, adjacent });
+        } else {
+            const int afterIdx = -bestIdx - 1;
+            linkAfter(node, entries.at(afterIdx).node);
+            entries.insert(afterIdx + 1, SortedGroup::Entry{ msgLine, node, true });
         }
-        ++curIdx;
     }
-    if (thisSize && !thisScore) {
-        thisIdx = curIdx;
-        thisScore = 1;
+
+    // Keep the unchanged prefix of m_messages and its index entries.
+    int pos = 0;
+    int node = head;
+    while (node == pos && pos < count) {
+        node = next[node];
+        ++pos;
+    }
+    TMM suffix;
+    suffix.reserve(count + msgs.count() - pos);
+    for (; node >= 0; node = next[node]) {
+        if (node < count)
+            suffix.append(std::move(m_messages[node]));
+        else
+            suffix.append(msgs.at(node - count));
+    }
+    m_messages.resize(pos);
+    m_messages.append(std::move(suffix));
+    if (pos < count)
+        m_refIndexOk = false;
+    if (m_indexOk) {
+        for (int i = pos; i < m_messages.count(); ++i)
+            addIndex(i, m_messages.at(i));
     }
-    if (thisScore > bestScore || (thisScore == bestScore && thisSize > bestSize))
-        insert(thisIdx, msg);
-    else if (bestScore)
-        insert(bestIdx, msg);
-    else
-        append(msg);
 }
 
 static QString guessFormat(const QString &filename, const QString &format)
@@ -367,22 +506,41 @@ int Translator::find(const TranslatorMessage &msg) const
     return i >= 0 && m_messages.at(i).id().isEmpty() ? i : -1;
 }
 
+void Translator::ensureRefIndexed() const
+{
+    ensureIndexed();
+    if (!m_refIndexOk) {
+        m_refIndexOk = true;
+        m_refIdx.clear();
+        for (int i = 0; i < m_messages.count(); i++) {
+            for (const TranslatorMessage::Reference &ref : m_messages.at(i).allReferences())
+                m_refIdx.insert(ref, i);
+        }
+    }
+}
+
 int Translator::find(const QString &context,
     const QString &comment, const TranslatorMessage::References &refs) const
 {
-    if (!refs.isEmpty()) {
-        for (auto it = m_messages.cbegin(), end = m_messages.cend(); it != end; ++it) {
-            if (it->context() == context && it->comment() == comment) {
-                for (const auto &itref : it->allReferences()) {
-                    for (const auto &ref : refs) {
-                        if (itref == ref)
-                            return it - m_messages.cbegin();
-                    }
-                }
+    if (refs.isEmpty())
+        return -1;
+    ensureRefIndexed();
+    // The index may still hold locations of messages that were replaced
+    // in place, so verify every candidate.
+    int found = -1;
+    for (const auto &ref : refs) {
+        for (auto it = m_refIdx.constFind(ref); it != m_refIdx.cend() && it.key() == ref; ++it) {
+            const int i = it.value();
+            if (found >= 0 && i >= found)
+                continue;
+            const TranslatorMessage &msg = m_messages.at(i);
+            if (msg.context() == context && msg.comment() == comment
+                    && msg.allReferences().contains(ref)) {
+                found = i;
             }
         }
     }
-    return -1;
+    return found;
 }
 
 int Translator::find(const QString &context) const
@@ -489,6 +647,7 @@ void Translator::dropUiLines()
         }
         message.setReferences(refs);
     }
+    m_refIndexOk = false;
 }
 
 class TranslatorMessagePtrBase
@@ -643,6 +802,7 @@ void Translator::makeFileNamesAbsolute(const QDir &originalPath)
             msg.addReference(fileName, ref.lineNumber());
         }
     }
+    m_refIndexOk = false;
 }
 
 const QList<TranslatorMessage> &Translator::messages() const
@@ -87,6 +87,11 @@ inline size_t qHash(const TMMKey &key)
     return qHash(key.context) ^ qHash(key.source) ^ qHash(key.comment);
 }
 
+inline size_t qHash(const TranslatorMessage::Reference &ref)
+{
+    return qHash(ref.fileName()) ^ qHash(ref.lineNumber());
+}
+
 class Translator
 {
 public:
@@ -105,6 +110,7 @@ public:
     void extend(const TranslatorMessage &msg, ConversionData &cd); // Only for single-location messages
     void append(const TranslatorMessage &msg);
     void appendSorted(const TranslatorMessage &msg);
+    void appendSorted(const QList<TranslatorMessage> &msgs);
 
     void stripObsoleteMessages();
     void stripFinishedMessages();
@@ -185,6 +191,7 @@ private:
     void addIndex(int idx, const TranslatorMessage &msg) const;
     void delIndex(int idx) const;
     void ensureIndexed() const;
+    void ensureRefIndexed() const;
 
     typedef QList<TranslatorMessage> TMM;       // int stores the sequence position.
 
@@ -209,6 +216,8 @@ private:
     mutable QHash<QString, int> m_ctxCmtIdx;
     mutable QHash<QString, int> m_idMsgIdx;
     mutable QHash<TMMKey, int> m_msgIdx;
+    mutable bool m_refIndexOk;
+    mutable QMultiHash<TranslatorMessage::Reference, int> m_refIdx;
 };
 
 bool getNumerusInfo(QLocale::Language language, QLocale::Country country,
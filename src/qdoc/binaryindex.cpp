@@ -0,0 +1,270 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "binaryindex.h"
+
+#include <QtCore/qhash.h>
+#include <QtCore/qsavefile.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+  \namespace BinaryIndex
+  \internal
+
+  A compact binary form of a qdoc index file.
+
+  The binary index contains the same elements and attributes as the
+  XML index it was converted from, laid out so that it can be memory
+  mapped and walked without any parsing:
+
+  \list
+    \li a header,
+    \li a table of interned strings (offset and size into the
+        character data),
+    \li the elements in document order, each with its name, its
+        attributes, and the index one past its last descendant,
+    \li the attributes, as pairs of string ids,
+    \li the UTF-16 character data.
+  \endlist
+
+  Text content of the XML index is not stored, as qdoc does not read
+  it back.
+ */
+
+static const char s_magic[8] = { 'Q', 'D', 'O', 'C', 'B', 'I', 'D', 'X' };
+static const quint32 s_version = 1;
+static const quint32 s_byteOrderMark = 0x01020304;
+
+/*!
+  Returns the path of the binary index that belongs to the XML
+  index file at \a indexPath.
+ */
+QString BinaryIndex::pathForIndexFile(const QString &indexPath)
+{
+    return indexPath + QLatin1String(".bin");
+}
+
+/*!
+  Converts the XML index file at \a indexPath into a binary index
+  next to it. Returns \c true on success.
+ */
+bool BinaryIndex::write(const QString &indexPath)
+{
+    QFile xmlFile(indexPath);
+    if (!xmlFile.open(QFile::ReadOnly))
+        return false;
+
+    QHash<QString, quint32> ids;
+    QList<StringEntry> strings;
+    QList<Element> elements;
+    QList<Attribute> attributes;
+    QList<qsizetype> open;
+    QString chars;
+
+    const auto intern = [&](QStringView string) -> quint32 {
+        const QString key = string.toString();
+        const auto it = ids.constFind(key);
+        if (it != ids.cend())
+            return *it;
+        const auto id = static_cast<quint32>(strings.size());
+        strings.append({ static_cast<quint32>(chars.size()), static_cast<quint32>(key.size()) });
+        chars.append(key);
+        ids.insert(key, id);
+        return id;
+    };
+
+    QXmlStreamReader reader(&xmlFile);
+    reader.setNamespaceProcessing(false);
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QXmlStreamReader::StartElement: {
+            const QXmlStreamAttributes xmlAttributes = reader.attributes();
+            open.append(elements.size());
+            elements.append({ intern(reader.qualifiedName()),
+                              static_cast<quint32>(attributes.size()),
+                              static_cast<quint32>(xmlAttributes.size()), 0 });
+            for (const auto &attribute : xmlAttributes)
+                attributes.append({ intern(attribute.qualifiedName()), intern(attribute.value()) });
+            break;
+        }
+        case QXmlStreamReader::EndElement:
+            elements[open.takeLast()].end = static_cast<quint32>(elements.size());
+            break;
+        default:
+            break;
+        }
+    }
+    if (reader.hasError() || elements.isEmpty())
+        return false;
+
+    Header header {};
+    std::memcpy(header.magic, s_magic, sizeof(s_magic));
+    header.version = s_version;
+    header.byteOrderMark = s_byteOrderMark;
+    header.stringCount = static_cast<quint32>(strings.size());
+    header.elementCount = static_cast<quint32>(elements.size());
+    header.attributeCount = static_cast<quint32>(attributes.size());
+    header.charCount = static_cast<quint32>(chars.size());
+
+    QSaveFile file(pathForIndexFile(indexPath));
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(strings.constData()),
+               strings.size() * sizeof(StringEntry));
+    file.write(reinterpret_cast<const char *>(elements.constData()),
+               elements.size() * sizeof(Element));
+    file.write(reinterpret_cast<const char *>(attributes.constData()),
+               attributes.size() * sizeof(Attribute));
+    file.write(reinterpret_cast<const char *>(chars.utf16()), chars.size() * sizeof(char16_t));
+    return file.commit();
+}
+
+/*!
+  \class BinaryIndexReader
+  \internal
+
+  Reads a binary index written by BinaryIndex::write().
+
+  The reader maps the file into memory and provides the subset of
+  the QXmlStreamReader API that QDocIndexFiles uses, so that the same
+  code reads either form of the index. Strings returned by the reader
+  refer to the mapped file and are only valid while the reader exists.
+ */
+
+BinaryIndexReader::~BinaryIndexReader()
+{
+    if (m_data)
+        m_file.unmap(m_data);
+}
+
+/*!
+  Maps the binary index at \a path and validates it. Returns
+  \c false if the file cannot be used, in which case the XML
+  index should be read instead.
+ */
+bool BinaryIndexReader::open(const QString &path)
+{
+    using namespace BinaryIndex;
+
+    m_file.setFileName(path);
+    if (!m_file.open(QFile::ReadOnly))
+        return false;
+    const qint64 size = m_file.size();
+    if (size < qint64(sizeof(Header)))
+        return false;
+    m_data = m_file.map(0, size);
+    if (!m_data)
+        return false;
+
+    Header header;
+    std::memcpy(&header, m_data, sizeof(header));
+    if (std::memcmp(header.magic, s_magic, sizeof(s_magic)) != 0 || header.version != s_version
+        || header.byteOrderMark != s_byteOrderMark || header.elementCount == 0) {
+        return false;
+    }
+
+    const qint64 stringsOffset = sizeof(Header);
+    const qint64 elementsOffset = stringsOffset + qint64(header.stringCount) * sizeof(StringEntry);
+    const qint64 attributesOffset = elementsOffset + qint64(header.elementCount) * sizeof(Element);
+    const qint64 charsOffset = attributesOffset + qint64(header.attributeCount) * sizeof(Attribute);
+    if (size != charsOffset + qint64(header.charCount) * qint64(sizeof(char16_t)))
+        return false;
+
+    m_strings = reinterpret_cast<const StringEntry *>(m_data + stringsOffset);
+    m_elements = reinterpret_cast<const Element *>(m_data + elementsOffset);
+    m_attributes = reinterpret_cast<const Attribute *>(m_data + attributesOffset);
+    m_chars = reinterpret_cast<const char16_t *>(m_data + charsOffset);
+    m_elementCount = header.elementCount;
+
+    // Validate once, so that reading needs no bounds checks.
+    for (quint32 i = 0; i < header.stringCount; ++i) {
+        if (quint64(m_strings[i].offset) + m_strings[i].size > header.charCount)
+            return false;
+    }
+    for (quint32 i = 0; i < header.attributeCount; ++i) {
+        if (m_attributes[i].name >= header.stringCount
+            || m_attributes[i].value >= header.stringCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_elementCount; ++i) {
+        const Element &element = m_elements[i];
+        if (element.name >= header.stringCount || element.end <= i
+            || element.end > m_elementCount
+            || quint64(element.firstAttribute) + element.attributeCount > header.attributeCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+  Moves to the next start or end element and returns its token type.
+ */
+QXmlStreamReader::TokenType BinaryIndexReader::readNext()
+{
+    if (m_token == QXmlStreamReader::EndDocument || m_token == QXmlStreamReader::Invalid) {
+        m_token = QXmlStreamReader::Invalid;
+        return m_token;
+    }
+
+    const quint32 end = m_open.isEmpty() ? m_elementCount : m_elements[m_open.last()].end;
+    if (m_next < end) {
+        m_current = m_next++;
+        m_open.append(m_current);
+        m_token = QXmlStreamReader::StartElement;
+    } else if (!m_open.isEmpty()) {
+        m_current = m_open.takeLast();
+        m_token = QXmlStreamReader::EndElement;
+    } else {
+        m_token = QXmlStreamReader::EndDocument;
+    }
+    return m_token;
+}
+
+/*!
+  Skips to the end of the current element. When positioned on a
+  start element, this is a constant-time jump past its descendants.
+ */
+void BinaryIndexReader::skipCurrentElement()
+{
+    if (m_token == QXmlStreamReader::StartElement) {
+        m_next = m_elements[m_current].end;
+        m_open.removeLast();
+        m_token = QXmlStreamReader::EndElement;
+        return;
+    }
+
+    int depth = 1;
+    while (depth && readNext() != QXmlStreamReader::Invalid) {
+        if (m_token == QXmlStreamReader::EndElement)
+            --depth;
+        else if (m_token == QXmlStreamReader::StartElement)
+            ++depth;
+    }
+}
+
+/*!
+  Returns the attributes of the current element. The values refer
+  to the mapped file and are not copied.
+ */
+QXmlStreamAttributes BinaryIndexReader::attributes() const
+{
+    QXmlStreamAttributes result;
+    const BinaryIndex::Element &element = m_elements[m_current];
+    result.reserve(element.attributeCount);
+    for (quint32 i = 0; i < element.attributeCount; ++i) {
+        const BinaryIndex::Attribute &attribute = m_attributes[element.firstAttribute + i];
+        const QStringView name = string(attribute.name);
+        const QStringView value = string(attribute.value);
+        result.append(QString::fromRawData(name.data(), name.size()),
+                      QString::fromRawData(value.data(), value.size()));
+    }
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,92 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef BINARYINDEX_H
+#define BINARYINDEX_H
+
+#include <QtCore/qfile.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qxmlstream.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace BinaryIndex {
+
+struct Header
+{
+    char magic[8];
+    quint32 version;
+    quint32 byteOrderMark;
+    quint32 stringCount;
+    quint32 elementCount;
+    quint32 attributeCount;
+    quint32 charCount;
+};
+
+struct StringEntry
+{
+    quint32 offset;
+    quint32 size;
+};
+
+struct Element
+{
+    quint32 name;
+    quint32 firstAttribute;
+    quint32 attributeCount;
+    quint32 end; // index one past the last descendant
+};
+
+struct Attribute
+{
+    quint32 name;
+    quint32 value;
+};
+
+QString pathForIndexFile(const QString &indexPath);
+bool write(const QString &indexPath);
+
+} // namespace BinaryIndex
+
+class BinaryIndexReader
+{
+public:
+    BinaryIndexReader() = default;
+    ~BinaryIndexReader();
+
+    bool open(const QString &path);
+
+    QXmlStreamReader::TokenType readNext();
+    bool readNextStartElement() { return readNext() == QXmlStreamReader::StartElement; }
+    void skipCurrentElement();
+    [[nodiscard]] bool isEndElement() const { return m_token == QXmlStreamReader::EndElement; }
+    [[nodiscard]] QStringView name() const { return string(m_elements[m_current].name); }
+    [[nodiscard]] QXmlStreamAttributes attributes() const;
+
+private:
+    Q_DISABLE_COPY_MOVE(BinaryIndexReader)
+
+    [[nodiscard]] QStringView string(quint32 id) const
+    {
+        const BinaryIndex::StringEntry &entry = m_strings[id];
+        return QStringView(m_chars + entry.offset, entry.size);
+    }
+
+    QFile m_file {};
+    uchar *m_data { nullptr };
+    const BinaryIndex::StringEntry *m_strings { nullptr };
+    const BinaryIndex::Element *m_elements { nullptr };
+    const BinaryIndex::Attribute *m_attributes { nullptr };
+    const char16_t *m_chars { nullptr };
+    quint32 m_elementCount { 0 };
+
+    QList<quint32> m_open {};
+    quint32 m_next { 0 };
+    quint32 m_current { 0 };
+    QXmlStreamReader::TokenType m_token { QXmlStreamReader::NoToken };
+};
+
+QT_END_NAMESPACE
+
+#endif // BINARYINDEX_H
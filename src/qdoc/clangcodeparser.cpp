@@ -16,9 +16,13 @@
 #include "utilities.h"
 #include "variablenode.h"
 
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatetime.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qelapsedtimer.h>
 #include <QtCore/qfile.h>
+#include <QtCore/qsavefile.h>
 #include <QtCore/qscopedvaluerollback.h>
 #include <QtCore/qtemporarydir.h>
 #include <QtCore/qtextstream.h>
@@ -26,7 +30,9 @@
 
 #include <clang-c/Index.h>
 
+#include <atomic>
 #include <cstdio>
+#include <thread>
 
 QT_BEGIN_NAMESPACE
 
@@ -1064,6 +1070,7 @@ void ClangCodeParser::initializeParser()
                          m_includePaths.end());
     CppCodeParser::initializeParser();
     m_pchFileDir.reset(nullptr);
+    m_pchBuilt = false;
     m_allHeaders.clear();
     m_pchName.clear();
     m_defines.clear();
@@ -1098,6 +1105,7 @@ void ClangCodeParser::initializeParser()
  */
 void ClangCodeParser::terminateParser()
 {
+    disposeParsedSourceFiles();
     CppCodeParser::terminateParser();
 }
 
@@ -1223,137 +1231,271 @@ void ClangCodeParser::getMoreArgs()
     }
 }
 
+/*!
+  Returns the directory in the qdoc cache directory where the PCH
+  for the current module is kept, or an empty string if no cache
+  directory is set.
+
+  The directory name is a hash of the clang version, the compiler
+  arguments, and \a headerContents, the contents of the header the
+  PCH is built from. Whether the PCH in that directory is still up to
+  date with the headers it includes is checked separately by
+  isCachedPCHUpToDate().
+ */
+QString ClangCodeParser::pchCacheDir(const QByteArray &headerContents) const
+{
+    const QString &cacheDir = Config::instance().cacheDir();
+    if (cacheDir.isEmpty())
+        return QString();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(fromCXString(clang_getClangVersion()).toUtf8());
+    for (const char *arg : m_args) {
+        hash.addData(QByteArrayView(arg));
+        hash.addData(QByteArrayView("\0", 1));
+    }
+    hash.addData(headerContents);
+    return cacheDir + QLatin1String("/pch/") + QString::fromLatin1(hash.result().toHex());
+}
+
+/*!
+  Returns \c true if the PCH in \a pchDir exists and none of the
+  files recorded by saveCachedPCHDependencies() changed since.
+ */
+static bool isCachedPCHUpToDate(const QString &pchDir, const QByteArray &module)
+{
+    QFile deps(pchDir + QLatin1Char('/') + QString::fromUtf8(module) + QLatin1String(".deps"));
+    if (!deps.open(QIODevice::ReadOnly | QIODevice::Text))
+        return false;
+
+    while (!deps.atEnd()) {
+        const QByteArray line = deps.readLine().chopped(1);
+        const QList<QByteArray> fields = line.split(' ');
+        if (fields.size() < 3)
+            return false;
+        const QFileInfo info(QString::fromUtf8(line.mid(fields[0].size() + fields[1].size() + 2)));
+        if (!info.exists() || info.size() != fields[0].toLongLong()
+            || info.lastModified().toMSecsSinceEpoch() != fields[1].toLongLong()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+  Records the size and modification time of every file included by
+  \a tu in the dependency file for the PCH of \a module in \a pchDir.
+ */
+static void saveCachedPCHDependencies(CXTranslationUnit tu, const QString &pchDir,
+                                      const QByteArray &module)
+{
+    QStringList files;
+    clang_getInclusions(
+            tu,
+            [](CXFile includedFile, CXSourceLocation *, unsigned, CXClientData data) {
+                static_cast<QStringList *>(data)->append(
+                        fromCXString(clang_getFileName(includedFile)));
+            },
+            &files);
+    files.removeDuplicates();
+
+    QSaveFile deps(pchDir + QLatin1Char('/') + QString::fromUtf8(module) + QLatin1String(".deps"));
+    if (!deps.open(QIODevice::WriteOnly | QIODevice::Text))
+        return;
+    for (const auto &file : qAsConst(files)) {
+        const QFileInfo info(file);
+        deps.write(QByteArray::number(info.size()) + ' '
+                   + QByteArray::number(info.lastModified().toMSecsSinceEpoch()) + ' '
+                   + file.toUtf8() + '\n');
+    }
+    deps.commit();
+}
+
 /*!
   Building the PCH must be possible when there are no .cpp
   files, so it is moved here to its own member function, and
   it is called after the list of header files is complete.
+
+  If a cache directory is set, the PCH and the header it is built
+  from are kept there, and a PCH built by an earlier qdoc run with
+  the same arguments is loaded instead of being built again, as long
+  as none of the headers it includes changed.
  */
 void ClangCodeParser::buildPCH()
 {
-    if (!m_pchFileDir && !moduleHeader().isEmpty()) {
-        m_pchFileDir.reset(new QTemporaryDir(QDir::tempPath() + QLatin1String("/qdoc_pch")));
-        if (m_pchFileDir->isValid()) {
-            const QByteArray module = moduleHeader().toUtf8();
-            QByteArray header;
-            QByteArray privateHeaderDir;
-            qCDebug(lcQdoc) << "Build and visit PCH for" << moduleHeader();
-            // A predicate for std::find_if() to locate a path to the module's header
-            // (e.g. QtGui/QtGui) to be used as pre-compiled header
-            struct FindPredicate
-            {
-                enum SearchType { Any, Module, Private };
-                QByteArray &candidate_;
-                const QByteArray &module_;
-                SearchType type_;
-                FindPredicate(QByteArray &candidate, const QByteArray &module,
-                              SearchType type = Any)
-                    : candidate_(candidate), module_(module), type_(type)
-                {
-                }
+    if (m_pchBuilt || moduleHeader().isEmpty())
+        return;
+    m_pchBuilt = true;
+
+    const QByteArray module = moduleHeader().toUtf8();
+    QByteArray header;
+    QByteArray privateHeaderDir;
+    qCDebug(lcQdoc) << "Build and visit PCH for" << moduleHeader();
+    // A predicate for std::find_if() to locate a path to the module's header
+    // (e.g. QtGui/QtGui) to be used as pre-compiled header
+    struct FindPredicate
+    {
+        enum SearchType { Any, Module, Private };
+        QByteArray &candidate_;
+        const QByteArray &module_;
+        SearchType type_;
+        FindPredicate(QByteArray &candidate, const QByteArray &module,
+                      SearchType type = Any)
+            : candidate_(candidate), module_(module), type_(type)
+        {
+        }
 
-                bool operator()(const QByteArray &p) const
-                {
-                    if (type_ != Any && !p.endsWith(module_))
-                        return false;
-                    candidate_ = p + "/";
-                    switch (type_) {
-                    case Any:
-                    case Module:
-                        candidate_.append(module_);
-                        break;
-                    case Private:
-                        candidate_.append("private");
-                        break;
-                    default:
-                        break;
-                    }
-                    if (p.startsWith("-I"))
-                        candidate_ = candidate_.mid(2);
-                    return QFile::exists(QString::fromUtf8(candidate_));
-                }
-            };
-
-            // First, search for an include path that contains the module name, then any path
-            QByteArray candidate;
-            auto it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
-                                   FindPredicate(candidate, module, FindPredicate::Module));
-            if (it == m_includePaths.end())
-                it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
-                                  FindPredicate(candidate, module, FindPredicate::Any));
-            if (it != m_includePaths.end())
-                header = candidate;
-
-            // Find the path to module's private headers - currently unused
-            it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
-                              FindPredicate(candidate, module, FindPredicate::Private));
-            if (it != m_includePaths.end())
-                privateHeaderDir = candidate;
-
-            if (header.isEmpty()) {
-                qWarning() << "(qdoc) Could not find the module header in include paths for module"
-                           << module << "  (include paths: " << m_includePaths << ")";
-                qWarning() << "       Artificial module header built from header dirs in qdocconf "
-                              "file";
+        bool operator()(const QByteArray &p) const
+        {
+            if (type_ != Any && !p.endsWith(module_))
+                return false;
+            candidate_ = p + "/";
+            switch (type_) {
+            case Any:
+            case Module:
+                candidate_.append(module_);
+                break;
+            case Private:
+                candidate_.append("private");
+                break;
+            default:
+                break;
             }
-            m_args.push_back("-xc++");
-            CXTranslationUnit tu;
-            QString tmpHeader = m_pchFileDir->path() + "/" + module;
-            QFile tmpHeaderFile(tmpHeader);
-            if (tmpHeaderFile.open(QIODevice::Text | QIODevice::WriteOnly)) {
-                QTextStream out(&tmpHeaderFile);
-                if (header.isEmpty()) {
-                    for (auto it = m_allHeaders.constKeyValueBegin();
-                         it != m_allHeaders.constKeyValueEnd(); ++it) {
-                        if (!(*it).first.endsWith(QLatin1String("_p.h"))
-                            && !(*it).first.startsWith(QLatin1String("moc_"))) {
-                            QString line = QLatin1String("#include \"") + (*it).second
-                                    + QLatin1String("/") + (*it).first + QLatin1String("\"");
-                            out << line << "\n";
-                        }
-                    }
-                } else {
-                    QFileInfo headerFile(header);
-                    if (!headerFile.exists()) {
-                        qWarning() << "Could not find module header file" << header;
-                        return;
-                    }
-                    out << QLatin1String("#include \"") + header + QLatin1String("\"");
-                }
-                tmpHeaderFile.close();
+            if (p.startsWith("-I"))
+                candidate_ = candidate_.mid(2);
+            return QFile::exists(QString::fromUtf8(candidate_));
+        }
+    };
+
+    // First, search for an include path that contains the module name, then any path
+    QByteArray candidate;
+    auto it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
+                           FindPredicate(candidate, module, FindPredicate::Module));
+    if (it == m_includePaths.end())
+        it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
+                          FindPredicate(candidate, module, FindPredicate::Any));
+    if (it != m_includePaths.end())
+        header = candidate;
+
+    // Find the path to module's private headers - currently unused
+    it = std::find_if(m_includePaths.begin(), m_includePaths.end(),
+                      FindPredicate(candidate, module, FindPredicate::Private));
+    if (it != m_includePaths.end())
+        privateHeaderDir = candidate;
+
+    if (header.isEmpty()) {
+        qWarning() << "(qdoc) Could not find the module header in include paths for module"
+                   << module << "  (include paths: " << m_includePaths << ")";
+        qWarning() << "       Artificial module header built from header dirs in qdocconf "
+                      "file";
+    }
+
+    QByteArray headerContents;
+    if (header.isEmpty()) {
+        for (auto it = m_allHeaders.constKeyValueBegin(); it != m_allHeaders.constKeyValueEnd();
+             ++it) {
+            if (!(*it).first.endsWith(QLatin1String("_p.h"))
+                && !(*it).first.startsWith(QLatin1String("moc_"))) {
+                headerContents += "#include \"" + (*it).second.toUtf8() + "/"
+                        + (*it).first.toUtf8() + "\"\n";
             }
+        }
+    } else {
+        QFileInfo headerFile(header);
+        if (!headerFile.exists()) {
+            qWarning() << "Could not find module header file" << header;
+            return;
+        }
+        headerContents = "#include \"" + header + "\"";
+    }
 
-            CXErrorCode err =
-                    clang_parseTranslationUnit2(index_, tmpHeader.toLatin1().data(), m_args.data(),
-                                                static_cast<int>(m_args.size()), nullptr, 0,
-                                                flags_ | CXTranslationUnit_ForSerialization, &tu);
-            qCDebug(lcQdoc) << __FUNCTION__ << "clang_parseTranslationUnit2(" << tmpHeader << m_args
-                            << ") returns" << err;
-
-            printDiagnostics(tu);
-
-            if (!err && tu) {
-                m_pchName = m_pchFileDir->path().toUtf8() + "/" + module + ".pch";
-                auto error = clang_saveTranslationUnit(tu, m_pchName.constData(),
-                                                       clang_defaultSaveOptions(tu));
-                if (error) {
-                    qCCritical(lcQdoc) << "Could not save PCH file for" << moduleHeader();
-                    m_pchName.clear();
-                } else {
-                    // Visit the header now, as token from pre-compiled header won't be visited
-                    // later
-                    CXCursor cur = clang_getTranslationUnitCursor(tu);
-                    ClangVisitor visitor(m_qdb, m_allHeaders);
-                    visitor.visitChildren(cur);
-                    qCDebug(lcQdoc) << "PCH built and visited for" << moduleHeader();
-                }
+    m_args.push_back("-xc++");
+    QString pchDir = pchCacheDir(headerContents);
+    const bool useCache = !pchDir.isEmpty() && QDir().mkpath(pchDir);
+    if (!useCache) {
+        m_pchFileDir.reset(new QTemporaryDir(QDir::tempPath() + QLatin1String("/qdoc_pch")));
+        if (!m_pchFileDir->isValid()) {
+            m_args.pop_back();
+            return;
+        }
+        pchDir = m_pchFileDir->path();
+    }
+    const QString tmpHeader = pchDir + "/" + module;
+    const QByteArray pchName = pchDir.toUtf8() + "/" + module + ".pch";
+
+    CXTranslationUnit tu = nullptr;
+    CXErrorCode err = CXError_Failure;
+    bool pchReady = false;
+    if (useCache && QFile::exists(QString::fromUtf8(pchName))
+        && isCachedPCHUpToDate(pchDir, module)) {
+        err = clang_createTranslationUnit2(index_, pchName.constData(), &tu);
+        qCDebug(lcQdoc) << __FUNCTION__ << "clang_createTranslationUnit2(" << pchName
+                        << ") returns" << err;
+        pchReady = !err && tu;
+        if (!pchReady) {
+            clang_disposeTranslationUnit(tu);
+            tu = nullptr;
+        }
+    }
+
+    if (!pchReady) {
+        // Keep an existing cached header as is; rewriting it would
+        // invalidate any PCH that another qdoc process built from it.
+        QFile tmpHeaderFile(tmpHeader);
+        if (!(useCache && tmpHeaderFile.exists())
+            && tmpHeaderFile.open(QIODevice::Text | QIODevice::WriteOnly)) {
+            tmpHeaderFile.write(headerContents);
+            tmpHeaderFile.close();
+        }
+
+        err = clang_parseTranslationUnit2(index_, tmpHeader.toLatin1().data(), m_args.data(),
+                                          static_cast<int>(m_args.size()), nullptr, 0,
+                                          flags_ | CXTranslationUnit_ForSerialization, &tu);
+        qCDebug(lcQdoc) << __FUNCTION__ << "clang_parseTranslationUnit2(" << tmpHeader << m_args
+                        << ") returns" << err;
+
+        printDiagnostics(tu);
+
+        if (!err && tu) {
+            // Save under a unique name first, so that concurrent qdoc
+            // processes sharing the cache never see a partial PCH.
+            const QByteArray savedName = useCache
+                    ? pchName + '.' + QByteArray::number(QCoreApplication::applicationPid())
+                    : pchName;
+            auto error = clang_saveTranslationUnit(tu, savedName.constData(),
+                                                   clang_defaultSaveOptions(tu));
+            if (error) {
+                qCCritical(lcQdoc) << "Could not save PCH file for" << moduleHeader();
+            } else if (useCache) {
+                QFile::remove(QString::fromUtf8(pchName));
+                pchReady = QFile::rename(QString::fromUtf8(savedName), QString::fromUtf8(pchName));
+                if (pchReady)
+                    saveCachedPCHDependencies(tu, pchDir, module);
+                else
+                    QFile::remove(QString::fromUtf8(savedName));
             } else {
-                m_pchFileDir->remove();
-                qCCritical(lcQdoc) << "Could not create PCH file for " << moduleHeader();
+                pchReady = true;
             }
-            clang_disposeTranslationUnit(tu);
-            m_args.pop_back(); // remove the "-xc++";
+        } else {
+            if (m_pchFileDir)
+                m_pchFileDir->remove();
+            qCCritical(lcQdoc) << "Could not create PCH file for " << moduleHeader();
         }
     }
+
+    if (pchReady) {
+        m_pchName = pchName;
+        // Visit the header now, as token from pre-compiled header won't be visited
+        // later
+        CXCursor cur = clang_getTranslationUnitCursor(tu);
+        ClangVisitor visitor(m_qdb, m_allHeaders);
+        visitor.visitChildren(cur);
+        qCDebug(lcQdoc) << "PCH built and visited for" << moduleHeader();
+    } else {
+        m_pchName.clear();
+    }
+    clang_disposeTranslationUnit(tu);
+    m_args.pop_back(); // remove the "-xc++";
 }
 
 /*!
@@ -1402,24 +1544,33 @@ void ClangCodeParser::parseSourceFile(const Location & /*location*/, const QStri
                                                   | CXTranslationUnit_SkipFunctionBodies
                                                   | CXTranslationUnit_KeepGoing);
 
-    index_ = clang_createIndex(1, kClangDontDisplayDiagnostics);
+    CXTranslationUnit tu;
+    CXErrorCode err;
+    const auto parsed = m_parsedSourceFiles.constFind(filePath);
+    if (parsed != m_parsedSourceFiles.cend()) {
+        index_ = parsed->index;
+        tu = parsed->translationUnit;
+        err = static_cast<CXErrorCode>(parsed->error);
+        m_parsedSourceFiles.erase(parsed);
+    } else {
+        index_ = clang_createIndex(1, kClangDontDisplayDiagnostics);
 
-    getDefaultArgs();
-    if (!m_pchName.isEmpty() && !filePath.endsWith(".mm")) {
-        m_args.push_back("-w");
-        m_args.push_back("-include-pch");
-        m_args.push_back(m_pchName.constData());
+        getDefaultArgs();
+        if (!m_pchName.isEmpty() && !filePath.endsWith(".mm")) {
+            m_args.push_back("-w");
+            m_args.push_back("-include-pch");
+            m_args.push_back(m_pchName.constData());
+        }
+        getMoreArgs();
+        for (const auto &p : qAsConst(m_moreArgs))
+            m_args.push_back(p.constData());
+
+        err = clang_parseTranslationUnit2(index_, filePath.toLocal8Bit(), m_args.data(),
+                                          static_cast<int>(m_args.size()), nullptr, 0, flags_,
+                                          &tu);
+        qCDebug(lcQdoc) << __FUNCTION__ << "clang_parseTranslationUnit2(" << filePath << m_args
+                        << ") returns" << err;
     }
-    getMoreArgs();
-    for (const auto &p : qAsConst(m_moreArgs))
-        m_args.push_back(p.constData());
-
-    CXTranslationUnit tu;
-    CXErrorCode err =
-            clang_parseTranslationUnit2(index_, filePath.toLocal8Bit(), m_args.data(),
-                                        static_cast<int>(m_args.size()), nullptr, 0, flags_, &tu);
-    qCDebug(lcQdoc) << __FUNCTION__ << "clang_parseTranslationUnit2(" << filePath << m_args
-                    << ") returns" << err;
     printDiagnostics(tu);
 
     if (err || !tu) {
@@ -1517,6 +1668,87 @@ void ClangCodeParser::parseSourceFile(const Location & /*location*/, const QStri
     s_fn.clear();
 }
 
+/*!
+  Parse the translation units of the C++ source files in \a filePaths
+  on up to \a jobs threads, each with its own CXIndex.
+
+  Only the clang parse runs concurrently. The parsed translation units
+  are kept until parseSourceFile() is called for the same file, which
+  then visits them and adds the documentation to the primary tree as
+  usual. Because the caller decides the order of those calls, the
+  resulting tree does not depend on the number of jobs.
+ */
+void ClangCodeParser::preparseSourceFiles(const QStringList &filePaths, int jobs)
+{
+    if (jobs < 2 || filePaths.size() < 2)
+        return;
+
+    flags_ = static_cast<CXTranslationUnit_Flags>(CXTranslationUnit_Incomplete
+                                                  | CXTranslationUnit_SkipFunctionBodies
+                                                  | CXTranslationUnit_KeepGoing);
+
+    // Build both argument lists up front; the worker threads only read them.
+    getDefaultArgs();
+    getMoreArgs();
+    std::vector<const char *> args = m_args;
+    std::vector<const char *> pchArgs = m_args;
+    if (!m_pchName.isEmpty()) {
+        pchArgs.push_back("-w");
+        pchArgs.push_back("-include-pch");
+        pchArgs.push_back(m_pchName.constData());
+    }
+    for (const auto &p : qAsConst(m_moreArgs)) {
+        args.push_back(p.constData());
+        pchArgs.push_back(p.constData());
+    }
+
+    std::vector<QByteArray> files;
+    files.reserve(filePaths.size());
+    for (const auto &filePath : filePaths)
+        files.push_back(filePath.toLocal8Bit());
+    std::vector<ParsedSourceFile> results(files.size());
+
+    std::atomic<size_t> next = 0;
+    std::vector<std::thread> workers;
+    const size_t workerCount = std::min(files.size(), size_t(jobs));
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers.emplace_back([&]() {
+            size_t idx;
+            while ((idx = next.fetch_add(1, std::memory_order_relaxed)) < files.size()) {
+                const auto &fileArgs = files[idx].endsWith(".mm") ? args : pchArgs;
+                ParsedSourceFile &result = results[idx];
+                result.index = clang_createIndex(1, kClangDontDisplayDiagnostics);
+                result.error = clang_parseTranslationUnit2(
+                        result.index, files[idx].constData(), fileArgs.data(),
+                        static_cast<int>(fileArgs.size()), nullptr, 0, flags_,
+                        &result.translationUnit);
+            }
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+
+    for (qsizetype i = 0; i < filePaths.size(); ++i) {
+        qCDebug(lcQdoc) << __FUNCTION__ << "clang_parseTranslationUnit2(" << filePaths[i]
+                        << (files[i].endsWith(".mm") ? args : pchArgs) << ") returns"
+                        << results[i].error;
+        m_parsedSourceFiles.insert(filePaths[i], results[i]);
+    }
+}
+
+/*!
+  Dispose of the translation units that were parsed by
+  preparseSourceFiles() but never visited.
+ */
+void ClangCodeParser::disposeParsedSourceFiles()
+{
+    for (const auto &parsed : qAsConst(m_parsedSourceFiles)) {
+        clang_disposeTranslationUnit(parsed.translationUnit);
+        clang_disposeIndex(parsed.index);
+    }
+    m_parsedSourceFiles.clear();
+}
+
 /*!
   Use clang to parse the function signature from a function
   command. \a location is used for reporting errors. \a fnSignature
@@ -25,14 +25,24 @@ public:
     void parseHeaderFile(const Location &location, const QString &filePath) override;
     void parseSourceFile(const Location &location, const QString &filePath) override;
     void precompileHeaders() override;
+    void preparseSourceFiles(const QStringList &filePaths, int jobs);
     Node *parseFnArg(const Location &location, const QString &fnSignature, const QString &idTag) override;
     static const QByteArray &fn() { return s_fn; }
 
 private:
+    struct ParsedSourceFile
+    {
+        void *index { nullptr };
+        CXTranslationUnit translationUnit { nullptr };
+        int error { 0 };
+    };
+
     void getDefaultArgs(); // FIXME: Clean up API
     void getMoreArgs(); // FIXME: Clean up API
 
     void buildPCH();
+    QString pchCacheDir(const QByteArray &headerContents) const;
+    void disposeParsedSourceFiles();
 
     void printDiagnostics(const CXTranslationUnit &translationUnit) const;
 
@@ -41,10 +51,12 @@ private:
     QList<QByteArray> m_includePaths {};
     QScopedPointer<QTemporaryDir> m_pchFileDir {};
     QByteArray m_pchName {};
+    bool m_pchBuilt { false };
     QList<QByteArray> m_defines {};
     std::vector<const char *> m_args {};
     QList<QByteArray> m_moreArgs {};
     QStringList m_namespaceScope {};
+    QHash<QString, ParsedSourceFile> m_parsedSourceFiles {};
     static QByteArray s_fn;
 };
 
@@ -8,6 +8,7 @@
 #include <QtCore/qfile.h>
 #include <QtCore/qtemporaryfile.h>
 #include <QtCore/qtextstream.h>
+#include <QtCore/qthread.h>
 #include <QtCore/qvariant.h>
 #include <QtCore/qregularexpression.h>
 
@@ -404,6 +405,27 @@ void Config::processCommandLineOptions(const QStringList &args)
     m_showInternal = m_parser.isSet(m_parser.showInternalOption)
             || qEnvironmentVariableIsSet("QDOC_SHOW_INTERNAL");
 
+    m_jobs = 1;
+    if (m_parser.isSet(m_parser.jobsOption)) {
+        bool ok = false;
+        m_jobs = m_parser.value(m_parser.jobsOption).toInt(&ok);
+        if (ok && m_jobs == 0)
+            m_jobs = QThread::idealThreadCount();
+        if (!ok || m_jobs < 1) {
+            qCWarning(lcQdoc) << "Invalid value for -jobs:" << m_parser.value(m_parser.jobsOption);
+            m_jobs = 1;
+        }
+    }
+
+    m_cacheDir.clear();
+    if (m_parser.isSet(m_parser.cacheDirOption)) {
+        m_cacheDir = QDir::current().absoluteFilePath(m_parser.value(m_parser.cacheDirOption));
+        if (!QDir().mkpath(m_cacheDir)) {
+            qCWarning(lcQdoc) << "Cannot create cache directory" << m_cacheDir;
+            m_cacheDir.clear();
+        }
+    }
+
     if (m_parser.isSet(m_parser.prepareOption))
         m_qdocPass = Prepare;
     if (m_parser.isSet(m_parser.generateOption))
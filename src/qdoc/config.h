@@ -113,6 +113,8 @@ public:
     [[nodiscard]] bool getDebug() const { return m_debug; }
     [[nodiscard]] bool getAtomsDump() const { return m_atomsDump; }
     [[nodiscard]] bool showInternal() const { return m_showInternal; }
+    [[nodiscard]] int jobs() const { return m_jobs; }
+    [[nodiscard]] const QString &cacheDir() const { return m_cacheDir; }
 
     void clear();
     void reset();
@@ -206,8 +208,10 @@ private:
     QStringList m_exampleDirs {};
     QString m_currentDir {};
     QString m_previousCurrentDir {};
+    QString m_cacheDir {};
 
     bool m_showInternal { false };
+    int m_jobs { 1 };
     static bool m_debug;
 
     // An option that can be set trough a similarly named command-line option.
@@ -3,52 +3,88 @@
 
 #include "editdistance.h"
 
+#include <QtCore/qvarlengtharray.h>
+
+#include <utility>
+
 QT_BEGIN_NAMESPACE
 
-int editDistance(const QString &s, const QString &t)
+/*!
+  Returns the edit distance between \a s and \a t, or \a bound + 1
+  if the distance is larger than \a bound.
+
+  Only the diagonal band of width 2 * \a bound + 1 is computed, two
+  rows at a time, and the computation stops as soon as no value in a
+  row is within \a bound.
+ */
+int boundedEditDistance(QStringView s, QStringView t, int bound)
 {
-#define D(i, j) d[(i)*n + (j)]
-    int i;
-    int j;
-    qsizetype m = s.length() + 1;
-    qsizetype n = t.length() + 1;
-    int *d = new int[m * n];
-    int result;
-
-    for (i = 0; i < m; ++i)
-        D(i, 0) = i;
-    for (j = 0; j < n; ++j)
-        D(0, j) = j;
-    for (i = 1; i < m; ++i) {
-        for (j = 1; j < n; ++j) {
-            if (s[i - 1] == t[j - 1]) {
-                D(i, j) = D(i - 1, j - 1);
-            } else {
-                int x = D(i - 1, j);
-                int y = D(i - 1, j - 1);
-                int z = D(i, j - 1);
-                D(i, j) = 1 + qMin(qMin(x, y), z);
-            }
+    const qsizetype m = s.size();
+    const qsizetype n = t.size();
+    const int outOfBound = bound + 1;
+    if (qAbs(m - n) > bound)
+        return outOfBound;
+
+    QVarLengthArray<int, 128> rows(2 * (n + 1));
+    int *previous = rows.data();
+    int *current = previous + n + 1;
+    for (qsizetype j = 0; j <= n; ++j)
+        previous[j] = j <= bound ? int(j) : outOfBound;
+
+    for (qsizetype i = 1; i <= m; ++i) {
+        const qsizetype from = qMax<qsizetype>(1, i - bound);
+        const qsizetype to = qMin<qsizetype>(n, i + bound);
+        current[from - 1] = (from == 1 && i <= bound) ? int(i) : outOfBound;
+        int rowMin = current[from - 1];
+        for (qsizetype j = from; j <= to; ++j) {
+            int value;
+            if (s[i - 1] == t[j - 1])
+                value = previous[j - 1];
+            else
+                value = 1 + qMin(qMin(previous[j], previous[j - 1]), current[j - 1]);
+            current[j] = qMin(value, outOfBound);
+            rowMin = qMin(rowMin, current[j]);
         }
+        if (to < n)
+            current[to + 1] = outOfBound;
+        if (rowMin > bound)
+            return outOfBound;
+        std::swap(previous, current);
     }
-    result = D(m - 1, n - 1);
-    delete[] d;
-    return result;
-#undef D
+    return previous[n];
+}
+
+int editDistance(const QString &s, const QString &t)
+{
+    return boundedEditDistance(s, t, int(qMax(s.size(), t.size())));
 }
 
+/*!
+  Returns the name in \a candidates that is closest to \a actual,
+  if there is exactly one such name within an edit distance of 2,
+  and both names together have at least 5 characters. Otherwise
+  returns an empty string.
+
+  Only candidates that start with the same character as \a actual
+  are considered.
+ */
 QString nearestName(const QString &actual, const QSet<QString> &candidates)
 {
     if (actual.isEmpty())
         return QString();
 
-    int deltaBest = 10000;
+    const int maxDelta = 2;
+    int deltaBest = maxDelta + 1;
     int numBest = 0;
     QString best;
 
     for (const auto &candidate : candidates) {
-        if (candidate[0] == actual[0]) {
-            int delta = editDistance(actual, candidate);
+        if (candidate.startsWith(actual[0])) {
+            // Distances above the current best can never win, and
+            // distances above maxDelta are never reported.
+            const int delta = boundedEditDistance(actual, candidate, qMin(deltaBest, maxDelta));
+            if (delta > maxDelta)
+                continue;
             if (delta < deltaBest) {
                 deltaBest = delta;
                 numBest = 1;
@@ -59,7 +95,7 @@ QString nearestName(const QString &actual, const QSet<QString> &candidates)
         }
     }
 
-    if (numBest == 1 && deltaBest <= 2 && actual.length() + best.length() >= 5)
+    if (numBest == 1 && actual.length() + best.length() >= 5)
         return best;
 
     return QString();
@@ -9,6 +9,7 @@
 
 QT_BEGIN_NAMESPACE
 
+int boundedEditDistance(QStringView s, QStringView t, int bound);
 int editDistance(const QString &s, const QString &t);
 QString nearestName(const QString &actual, const QSet<QString> &candidates);
 
@@ -541,9 +541,34 @@ static void processQdocconfFile(const QString &fileName)
         */
         parsed = 0;
         qCInfo(lcQdoc) << "Parse source files for" << project;
-        for (const auto &key : sources.keys()) {
+        /*
+          With -jobs, the C++ sources are first parsed by clang in
+          parallel, up to jobs of them at a time. The documentation is
+          still extracted and added to the tree one file at a time, in
+          the same order as in a serial run.
+        */
+        const int jobs = config.jobs();
+        const QStringList sourceKeys = sources.keys();
+        QStringList cppSources;
+        if (jobs > 1) {
+            for (const auto &key : sourceKeys) {
+                if (CodeParser::parserForSourceFile(key) == clangParser_)
+                    cppSources.append(key);
+            }
+        }
+        qsizetype cppParsed = 0;
+        qsizetype cppPreparsed = 0;
+        for (const auto &key : sourceKeys) {
             auto *codeParser = CodeParser::parserForSourceFile(key);
             if (codeParser) {
+                if (codeParser == clangParser_ && !cppSources.isEmpty()) {
+                    if (cppParsed == cppPreparsed) {
+                        clangParser_->preparseSourceFiles(cppSources.mid(cppPreparsed, jobs),
+                                                          jobs);
+                        cppPreparsed += jobs;
+                    }
+                    ++cppParsed;
+                }
                 ++parsed;
                 qCDebug(lcQdoc, "Parsing %s", qPrintable(key));
                 codeParser->parseSourceFile(config.location(), key);
@@ -35,7 +35,9 @@ QDocCommandLineParser::QDocCommandLineParser()
       frameworkOption("F", "Add macOS framework to the include path for header files.",
                       "framework"),
       timestampsOption(QStringList() << QStringLiteral("timestamps")),
-      useDocBookExtensions(QStringList() << QStringLiteral("docbook-extensions"))
+      useDocBookExtensions(QStringList() << QStringLiteral("docbook-extensions")),
+      jobsOption(QStringList() << QStringLiteral("j") << QStringLiteral("jobs")),
+      cacheDirOption(QStringList() << QStringLiteral("cache-dir"))
 {
     setApplicationDescription(QCoreApplication::translate("qdoc", "Qt documentation generator"));
     addHelpOption();
@@ -140,6 +142,17 @@ QDocCommandLineParser::QDocCommandLineParser()
     useDocBookExtensions.setDescription(QCoreApplication::translate(
             "qdoc", "Use the DocBook Library extensions for metadata."));
     addOption(useDocBookExtensions);
+
+    jobsOption.setDescription(QCoreApplication::translate(
+            "qdoc", "Use up to <count> threads for parsing source files (0 = ideal thread count)."));
+    jobsOption.setValueName(QStringLiteral("count"));
+    addOption(jobsOption);
+
+    cacheDirOption.setDescription(QCoreApplication::translate(
+            "qdoc", "Keep state between qdoc runs, such as precompiled "
+                    "headers, in <dir>."));
+    cacheDirOption.setValueName(QStringLiteral("dir"));
+    addOption(cacheDirOption);
 }
 
 /*!
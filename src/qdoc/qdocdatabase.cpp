@@ -128,6 +128,8 @@ void QDocForest::setPrimaryTree(const QString &t)
     m_forest.remove(T);
     if (m_primaryTree == nullptr)
         qDebug() << "ERROR: Could not set primary tree to:" << t;
+    else
+        m_primaryTree->clearTargetCache();
 }
 
 /*!
@@ -277,6 +279,9 @@ void QDocForest::newPrimaryTree(const QString &module)
   If \a targetPath is resolved successfully but it refers to
   a \\section title, continue the search, keeping the section
   title as a fallback if no higher-priority targets are found.
+
+  Lookups in trees other than the primary tree are cached per
+  tree, see Tree::findCachedNodeForTarget().
  */
 const Node *QDocForest::findNodeForTarget(QStringList &targetPath, const Node *relative,
                                           Node::Genus genus, QString &ref)
@@ -292,17 +297,26 @@ const Node *QDocForest::findNodeForTarget(QStringList &targetPath, const Node *r
 
     TargetRec::TargetType type = TargetRec::Unknown;
     const Node *tocNode = nullptr;
+    QString tocRef;
     for (const auto *tree : searchOrder()) {
-        const Node *n = tree->findNodeForTarget(entityPath, target, relative, flags, genus, ref, &type);
+        const Node *n = nullptr;
+        if (relative == nullptr && tree != primaryTree())
+            n = tree->findCachedNodeForTarget(entityPath, target, flags, genus, ref, &type);
+        else
+            n = tree->findNodeForTarget(entityPath, target, relative, flags, genus, ref, &type);
         if (n) {
             // Targets referring to non-section titles are returned immediately
             if (type != TargetRec::Contents)
                 return n;
-            if (!tocNode)
+            if (!tocNode) {
                 tocNode = n;
+                tocRef = ref;
+            }
         }
         relative = nullptr;
     }
+    if (tocNode)
+        ref = tocRef;
     return tocNode;
 }
 
@@ -1582,6 +1596,9 @@ const Node *QDocDatabase::findNodeForAtom(const Atom *a, const Node *relative, Q
                 target = targetPath.takeFirst();
             if (relative && relative->tree()->physicalModuleName() != domain->physicalModuleName())
                 relative = nullptr;
+            if (relative == nullptr && domain != primaryTree())
+                return domain->findCachedNodeForTarget(nodePath, target, flags, genus, ref,
+                                                       nullptr);
             return domain->findNodeForTarget(nodePath, target, relative, flags, genus, ref);
         }
     } else {
@@ -5,6 +5,7 @@
 
 #include "access.h"
 #include "atom.h"
+#include "binaryindex.h"
 #include "classnode.h"
 #include "collectionnode.h"
 #include "config.h"
@@ -22,6 +23,7 @@
 #include "typedefnode.h"
 #include "variablenode.h"
 
+#include <QtCore/qfileinfo.h>
 #include <QtCore/qxmlstream.h>
 
 #include <algorithm>
@@ -102,9 +104,23 @@ void QDocIndexFiles::readIndexes(const QStringList &indexFiles)
 
 /*!
   Reads and parses the index file at \a path.
+
+  If a binary index that is at least as recent as the XML index
+  exists next to it, the binary index is read instead.
  */
 void QDocIndexFiles::readIndexFile(const QString &path)
 {
+    const QString binaryPath = BinaryIndex::pathForIndexFile(path);
+    const QFileInfo binaryInfo(binaryPath);
+    if (binaryInfo.exists() && binaryInfo.lastModified() >= QFileInfo(path).lastModified()) {
+        BinaryIndexReader reader;
+        if (reader.open(binaryPath)) {
+            readIndex(reader, path);
+            return;
+        }
+        qCDebug(lcQdoc) << "Ignoring invalid binary index file" << binaryPath;
+    }
+
     QFile file(path);
     if (!file.open(QFile::ReadOnly)) {
         qWarning() << "Could not read index file" << path;
@@ -113,7 +129,16 @@ void QDocIndexFiles::readIndexFile(const QString &path)
 
     QXmlStreamReader reader(&file);
     reader.setNamespaceProcessing(false);
+    readIndex(reader, path);
+}
 
+/*!
+  Reads the index at \a path from \a reader, which is either a
+  QXmlStreamReader or a BinaryIndexReader, into a new index tree.
+ */
+template<typename Reader>
+void QDocIndexFiles::readIndex(Reader &reader, const QString &path)
+{
     if (!reader.readNextStartElement())
         return;
 
@@ -162,8 +187,8 @@ void QDocIndexFiles::readIndexFile(const QString &path)
   Read a <section> element from the index file and create the
   appropriate node(s).
  */
-void QDocIndexFiles::readIndexSection(QXmlStreamReader &reader, Node *current,
-                                      const QString &indexUrl)
+template<typename Reader>
+void QDocIndexFiles::readIndexSection(Reader &reader, Node *current, const QString &indexUrl)
 {
     QXmlStreamAttributes attributes = reader.attributes();
     QStringView elementName = reader.name();
@@ -1411,6 +1436,9 @@ void QDocIndexFiles::generateIndex(const QString &fileName, const QString &url,
     writer.writeEndElement(); // QDOCINDEX
     writer.writeEndDocument();
     file.close();
+
+    if (!BinaryIndex::write(fileName))
+        qCWarning(lcQdoc) << "Could not write binary index for" << fileName;
 }
 
 QT_END_NAMESPACE
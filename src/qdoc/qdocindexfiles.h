@@ -40,7 +40,10 @@ private:
 
     void readIndexes(const QStringList &indexFiles);
     void readIndexFile(const QString &path);
-    void readIndexSection(QXmlStreamReader &reader, Node *current, const QString &indexUrl);
+    template<typename Reader>
+    void readIndex(Reader &reader, const QString &path);
+    template<typename Reader>
+    void readIndexSection(Reader &reader, Node *current, const QString &indexUrl);
     void insertTarget(TargetRec::TargetType type, const QXmlStreamAttributes &attributes,
                       Node *node);
     void resolveIndex();
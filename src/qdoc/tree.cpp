@@ -519,6 +519,39 @@ const Node *Tree::findNodeForTarget(const QStringList &path, const QString &targ
     return node;
 }
 
+/*!
+  Same as findNodeForTarget() with no start node, but remembers the
+  result for each combination of \a path, \a target, \a flags, and
+  \a genus. This is only used for trees other than the primary tree,
+  which no longer change once they are loaded, so that a link to the
+  same target from many pages is resolved by a single hash lookup
+  per tree.
+
+  \a ref is only set if a node is found, and \a targetType is only
+  set if the lookup determined a target type.
+ */
+const Node *Tree::findCachedNodeForTarget(const QStringList &path, const QString &target,
+                                          int flags, Node::Genus genus, QString &ref,
+                                          TargetRec::TargetType *targetType) const
+{
+    const QString key = QString::number(flags) + QLatin1Char(' ') + QString::number(genus)
+            + QLatin1Char(' ') + path.join(QLatin1String("::")) + QLatin1Char('#') + target;
+    auto it = m_targetCache.constFind(key);
+    if (it == m_targetCache.cend()) {
+        CachedTarget cached;
+        cached.m_node =
+                findNodeForTarget(path, target, nullptr, flags, genus, cached.m_ref, &cached.m_type);
+        if (!cached.m_node)
+            cached.m_ref.clear();
+        it = m_targetCache.insert(key, cached);
+    }
+    if (it->m_node)
+        ref = it->m_ref;
+    if (targetType && it->m_type != TargetRec::Unknown)
+        *targetType = it->m_type;
+    return it->m_node;
+}
+
 /*!
   First, the \a path is used to find a node. The \a path
   matches some part of the node's fully quallified name.
@@ -11,6 +11,7 @@
 #include "proxynode.h"
 #include "qmltypenode.h"
 
+#include <QtCore/qhash.h>
 #include <QtCore/qstack.h>
 
 #include <utility>
@@ -84,6 +85,10 @@ private: // The rest of the class is private.
     const Node *findNodeForTarget(const QStringList &path, const QString &target, const Node *node,
                                   int flags, Node::Genus genus, QString &ref,
                                   TargetRec::TargetType *targetType = nullptr) const;
+    const Node *findCachedNodeForTarget(const QStringList &path, const QString &target,
+                                        int flags, Node::Genus genus, QString &ref,
+                                        TargetRec::TargetType *targetType) const;
+    void clearTargetCache() { m_targetCache.clear(); }
     const Node *matchPathAndTarget(const QStringList &path, int idx, const QString &target,
                                    const Node *node, int flags, Node::Genus genus,
                                    QString &ref) const;
@@ -159,6 +164,13 @@ private: // The rest of the class is private.
     FunctionNode *findMacroNode(const QString &t, const Aggregate *parent = nullptr);
 
 private:
+    struct CachedTarget
+    {
+        const Node *m_node { nullptr };
+        QString m_ref {};
+        TargetRec::TargetType m_type { TargetRec::Unknown };
+    };
+
     bool m_treeHasBeenAnalyzed {};
     QString m_camelCaseModuleName {};
     QString m_physicalModuleName {};
@@ -177,6 +189,7 @@ private:
     ExampleNodeMap m_exampleNodeMap {};
     NodeList m_proxies {};
     NodeMap m_dontDocumentMap {};
+    mutable QHash<QString, CachedTarget> m_targetCache {};
 };
 
 QT_END_NAMESPACE
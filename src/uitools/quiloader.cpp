@@ -11,10 +11,12 @@
 #include <formbuilderextra_p.h>
 #include <textbuilder_p.h>
 #include <ui4_p.h>
+#include <uibinaryformat_p.h>
 
 #include <QtWidgets/qapplication.h>
 #include <QtWidgets/qlayout.h>
 #include <QtWidgets/qwidget.h>
+#include <QtWidgets/qstackedwidget.h>
 #include <QtWidgets/qtabwidget.h>
 #include <QtWidgets/qtreewidget.h>
 #include <QtWidgets/qlistwidget.h>
@@ -26,12 +28,22 @@
 #include <QtGui/qaction.h>
 #include <QtGui/qactiongroup.h>
 
+#include <QtCore/qbuffer.h>
 #include <QtCore/qdebug.h>
+#include <QtCore/qcryptographichash.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qsavefile.h>
 #include <QtCore/qmap.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qset.h>
+#include <QtCore/qsharedpointer.h>
 #include <QtCore/qdir.h>
 #include <QtCore/qlibraryinfo.h>
 
+#include <limits.h>
+
 QT_BEGIN_NAMESPACE
 
 typedef QMap<QString, bool> widget_map;
@@ -284,6 +296,60 @@ private:
     bool m_idBased;
 };
 
+class DeferredPageLoader;
+
+// The parts of a form needed to create the contents of its deferred pages
+// (see QUiLoader::setDeferredPageLoadingEnabled()) after the form is loaded.
+struct DeferredForm
+{
+    QScopedPointer<DomUI> customWidgets;
+    QPointer<QWidget> parentWidget; // The parent the form was loaded into
+    QByteArray className;
+    QPointer<TranslationWatcher> translationWatcher;
+    DeferredPageLoader *pageLoader = nullptr;
+    int defaultMargin = INT_MIN;
+    int defaultSpacing = INT_MIN;
+    bool idBased = false;
+    bool hasDeferredPages = false;
+    QSet<QString> referencedNames; // Senders, receivers and tab stops
+    QMultiHash<QString, QString> buddyLabels; // Buddy name -> label name
+};
+
+class FormBuilderPrivate;
+
+// Creates the contents of the deferred pages of a form when they are shown
+// for the first time. It is a child of the form's top level widget, so the
+// pages stay deferred after the loader is destroyed; they are then created
+// by a builder of its own, with the loader's settings.
+class DeferredPageLoader : public QObject
+{
+public:
+    explicit DeferredPageLoader(FormBuilderPrivate *builder) : m_builder(builder) {}
+    ~DeferredPageLoader() override;
+
+    void addPage(QWidget *page, DomWidget *contents, const QSharedPointer<DeferredForm> &form);
+    void detachBuilder();
+
+    bool eventFilter(QObject *o, QEvent *event) override;
+
+private:
+    struct Page
+    {
+        DomWidget *contents;
+        QSharedPointer<DeferredForm> form;
+    };
+
+    void loadPage(QWidget *page);
+
+    FormBuilderPrivate *m_builder;
+    QScopedPointer<FormBuilderPrivate> m_ownBuilder;
+    QStringList m_pluginPaths;
+    QDir m_workingDirectory;
+    bool m_trEnabled = true;
+    bool m_dynamicTr = false;
+    QHash<QObject *, Page> m_pages;
+};
+
 class FormBuilderPrivate: public QFormBuilder
 {
     friend class QT_PREPEND_NAMESPACE(QUiLoader);
@@ -295,8 +361,10 @@ public:
 
     bool dynamicTr = false;
     bool trEnabled = true;
+    bool deferredPageLoading = false;
 
     FormBuilderPrivate() = default;
+    ~FormBuilderPrivate() override;
 
     QWidget *defaultCreateWidget(const QString &className, QWidget *parent, const QString &name)
     {
@@ -318,9 +386,11 @@ public:
         return ParentClass::createActionGroup(parent, name);
     }
 
+    // Without a loader, deferred pages are created after the loader was destroyed.
     QWidget *createWidget(const QString &className, QWidget *parent, const QString &name) override
     {
-        if (QWidget *widget = loader->createWidget(className, parent, name)) {
+        if (QWidget *widget = loader ? loader->createWidget(className, parent, name)
+                                     : defaultCreateWidget(className, parent, name)) {
             widget->setObjectName(name);
             return widget;
         }
@@ -330,7 +400,8 @@ public:
 
     QLayout *createLayout(const QString &className, QObject *parent, const QString &name) override
     {
-        if (QLayout *layout = loader->createLayout(className, parent, name)) {
+        if (QLayout *layout = loader ? loader->createLayout(className, parent, name)
+                                     : defaultCreateLayout(className, parent, name)) {
             layout->setObjectName(name);
             return layout;
         }
@@ -340,7 +411,8 @@ public:
 
     QActionGroup *createActionGroup(QObject *parent, const QString &name) override
     {
-        if (QActionGroup *actionGroup = loader->createActionGroup(parent, name)) {
+        if (QActionGroup *actionGroup = loader ? loader->createActionGroup(parent, name)
+                                               : defaultCreateActionGroup(parent, name)) {
             actionGroup->setObjectName(name);
             return actionGroup;
         }
@@ -350,7 +422,8 @@ public:
 
     QAction *createAction(QObject *parent, const QString &name)  override
     {
-        if (QAction *action = loader->createAction(parent, name)) {
+        if (QAction *action = loader ? loader->createAction(parent, name)
+                                     : defaultCreateAction(parent, name)) {
             action->setObjectName(name);
             return action;
         }
@@ -363,10 +436,24 @@ public:
     QWidget *create(DomWidget *ui_widget, QWidget *parentWidget) override;
     bool addItem(DomWidget *ui_widget, QWidget *widget, QWidget *parentWidget) override;
 
+    QWidget *loadCached(QFile *file, const QString &cacheDirectory, QWidget *parentWidget);
+
+    void loadDeferredPage(QWidget *page, DomWidget *contents,
+                          const QSharedPointer<DeferredForm> &form);
+
 private:
+    bool canDeferPageContents(const DomWidget *ui_page) const;
+    QList<DomWidget *> deferPageContents(DomWidget *ui_widget);
+    void registerDeferredPages(QWidget *container, const QList<DomWidget *> &ui_pages,
+                               const QList<DomWidget *> &contents);
+
     QByteArray m_class;
     TranslationWatcher *m_trwatch = nullptr;
     bool m_idBased = false;
+    QSharedPointer<DeferredForm> m_deferredForm;
+    // The page loaders of the forms loaded so far, detached when the
+    // builder is destroyed.
+    QList<QPointer<DeferredPageLoader>> m_pageLoaders;
 };
 
 static QString convertTranslatable(const DomProperty *p, const QByteArray &className,
@@ -421,18 +508,250 @@ void FormBuilderPrivate::applyProperties(QObject *o, const QList<DomProperty*> &
         o->installEventFilter(m_trwatch);
 }
 
+// Appends \a ui_widget and the widgets below it to \a widgets and their
+// names and the names of their layouts to \a names.
+static void collectDomWidgets(const DomWidget *ui_widget, QList<const DomWidget *> *widgets,
+                              QSet<QString> *names);
+
+static void collectDomWidgets(const DomLayout *ui_layout, QList<const DomWidget *> *widgets,
+                              QSet<QString> *names)
+{
+    names->insert(ui_layout->attributeName());
+    const auto &items = ui_layout->elementItem();
+    for (const DomLayoutItem *item : items) {
+        switch (item->kind()) {
+        case DomLayoutItem::Widget:
+            collectDomWidgets(item->elementWidget(), widgets, names);
+            break;
+        case DomLayoutItem::Layout:
+            collectDomWidgets(item->elementLayout(), widgets, names);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void collectDomWidgets(const DomWidget *ui_widget, QList<const DomWidget *> *widgets,
+                              QSet<QString> *names)
+{
+    widgets->append(ui_widget);
+    names->insert(ui_widget->attributeName());
+    const auto &childWidgets = ui_widget->elementWidget();
+    for (const DomWidget *child : childWidgets)
+        collectDomWidgets(child, widgets, names);
+    const auto &layouts = ui_widget->elementLayout();
+    for (const DomLayout *layout : layouts)
+        collectDomWidgets(layout, widgets, names);
+}
+
+static bool isPageContainerClass(const QString &className)
+{
+    return className == QLatin1String("QTabWidget")
+        || className == QLatin1String("QStackedWidget")
+        || className == QLatin1String("QToolBox");
+}
+
+static QWidget *containerPage(QWidget *container, int index)
+{
+    if (0) {
+#if QT_CONFIG(tabwidget)
+    } else if (QTabWidget *tabWidget = qobject_cast<QTabWidget*>(container)) {
+        return tabWidget->widget(index);
+#endif
+#if QT_CONFIG(stackedwidget)
+    } else if (QStackedWidget *stackedWidget = qobject_cast<QStackedWidget*>(container)) {
+        return stackedWidget->widget(index);
+#endif
+#if QT_CONFIG(toolbox)
+    } else if (QToolBox *toolBox = qobject_cast<QToolBox*>(container)) {
+        return toolBox->widget(index);
+#endif
+    }
+    return nullptr;
+}
+
 QWidget *FormBuilderPrivate::create(DomUI *ui, QWidget *parentWidget)
 {
     m_class = ui->elementClass().toUtf8();
     m_trwatch = nullptr;
     m_idBased = ui->attributeIdbasedtr();
     setTextBuilder(new TranslatingTextBuilder(m_idBased, trEnabled, m_class));
-    return QFormBuilder::create(ui, parentWidget);
+    if (!deferredPageLoading)
+        return QFormBuilder::create(ui, parentWidget);
+
+    // Objects referenced from outside of their page prevent deferring it.
+    QSharedPointer<DeferredForm> form(new DeferredForm);
+    if (const DomConnections *connections = ui->elementConnections()) {
+        const auto &elementConnection = connections->elementConnection();
+        for (const DomConnection *connection : elementConnection) {
+            form->referencedNames.insert(connection->elementSender());
+            form->referencedNames.insert(connection->elementReceiver());
+        }
+    }
+    if (const DomTabStops *tabStops = ui->elementTabStops()) {
+        const QStringList tabStopNames = tabStops->elementTabStop();
+        for (const QString &name : tabStopNames)
+            form->referencedNames.insert(name);
+    }
+    if (const DomWidget *ui_widget = ui->elementWidget()) {
+        const QFormBuilderStrings &strings = QFormBuilderStrings::instance();
+        QList<const DomWidget *> widgets;
+        QSet<QString> names;
+        collectDomWidgets(ui_widget, &widgets, &names);
+        for (const DomWidget *w : qAsConst(widgets)) {
+            const auto &properties = w->elementProperty();
+            for (const DomProperty *p : properties) {
+                if (p->attributeName() != strings.buddyProperty)
+                    continue;
+                if (p->kind() == DomProperty::Cstring)
+                    form->buddyLabels.insert(p->elementCstring(), w->attributeName());
+                else if (p->kind() == DomProperty::String && p->elementString())
+                    form->buddyLabels.insert(p->elementString()->text(), w->attributeName());
+            }
+        }
+    }
+
+    m_deferredForm = form;
+    QWidget *widget = QFormBuilder::create(ui, parentWidget);
+    m_deferredForm.reset();
+
+    if (!widget)
+        delete form->pageLoader;
+    if (widget && form->hasDeferredPages) {
+        form->pageLoader->setParent(widget);
+        m_pageLoaders.removeIf([](const QPointer<DeferredPageLoader> &pageLoader) {
+            return pageLoader.isNull();
+        });
+        m_pageLoaders.append(form->pageLoader);
+        form->parentWidget = parentWidget;
+        form->className = m_class;
+        form->idBased = m_idBased;
+        form->translationWatcher = m_trwatch;
+        if (const DomLayoutDefault *def = ui->elementLayoutDefault()) {
+            form->defaultMargin = def->hasAttributeMargin() ? def->attributeMargin() : INT_MIN;
+            form->defaultSpacing = def->hasAttributeSpacing() ? def->attributeSpacing() : INT_MIN;
+        }
+        form->customWidgets.reset(new DomUI);
+        form->customWidgets->setElementCustomWidgets(ui->takeElementCustomWidgets());
+    }
+    return widget;
+}
+
+// A page can be deferred if it has contents that nothing outside of it
+// refers to. Actions and button groups are registered with the form while
+// loading, so pages using them are created right away.
+bool FormBuilderPrivate::canDeferPageContents(const DomWidget *ui_page) const
+{
+    if (ui_page->elementWidget().isEmpty() && ui_page->elementLayout().isEmpty())
+        return false;
+
+    QList<const DomWidget *> widgets;
+    QSet<QString> names;
+    const auto &childWidgets = ui_page->elementWidget();
+    for (const DomWidget *child : childWidgets)
+        collectDomWidgets(child, &widgets, &names);
+    const auto &layouts = ui_page->elementLayout();
+    for (const DomLayout *layout : layouts)
+        collectDomWidgets(layout, &widgets, &names);
+
+    for (const DomWidget *w : qAsConst(widgets)) {
+        if (!w->elementAction().isEmpty() || !w->elementActionGroup().isEmpty()
+            || !w->elementAddAction().isEmpty()) {
+            return false;
+        }
+        const auto &attributes = w->elementAttribute();
+        for (const DomProperty *a : attributes) {
+            if (a->attributeName() == QLatin1String("buttonGroup"))
+                return false;
+        }
+    }
+
+    for (const QString &name : qAsConst(names)) {
+        if (m_deferredForm->referencedNames.contains(name))
+            return false;
+        const auto cend = m_deferredForm->buddyLabels.cend();
+        for (auto it = m_deferredForm->buddyLabels.constFind(name); it != cend && it.key() == name; ++it) {
+            if (!names.contains(it.value()))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Moves the contents of the inactive pages of the page container
+// \a ui_widget out of the DOM. Returns them in the order of the pages,
+// with nullptr for pages that are created right away.
+QList<DomWidget *> FormBuilderPrivate::deferPageContents(DomWidget *ui_widget)
+{
+    const QFormBuilderStrings &strings = QFormBuilderStrings::instance();
+    int currentIndex = 0;
+    const auto &properties = ui_widget->elementProperty();
+    for (const DomProperty *p : properties) {
+        if (p->attributeName() == strings.currentIndexProperty && p->kind() == DomProperty::Number)
+            currentIndex = p->elementNumber();
+    }
+
+    QList<DomWidget *> contents;
+    const auto &pages = ui_widget->elementWidget();
+    bool deferred = false;
+    for (qsizetype i = 0, count = pages.size(); i < count; ++i) {
+        DomWidget *ui_page = pages.at(i);
+        if (i == currentIndex || !canDeferPageContents(ui_page)) {
+            contents.append(nullptr);
+            continue;
+        }
+        DomWidget *holder = new DomWidget;
+        holder->setElementWidget(ui_page->elementWidget());
+        holder->setElementLayout(ui_page->elementLayout());
+        holder->setElementZOrder(ui_page->elementZOrder());
+        ui_page->setElementWidget({});
+        ui_page->setElementLayout({});
+        ui_page->setElementZOrder({});
+        contents.append(holder);
+        deferred = true;
+    }
+    if (!deferred)
+        contents.clear();
+    return contents;
+}
+
+// Hands the deferred \a contents of the pages created from \a ui_pages
+// to the page loader.
+void FormBuilderPrivate::registerDeferredPages(QWidget *container, const QList<DomWidget *> &ui_pages,
+                                               const QList<DomWidget *> &contents)
+{
+    for (qsizetype i = 0, count = contents.size(); i < count; ++i) {
+        QScopedPointer<DomWidget> holder(contents.at(i));
+        if (holder.isNull())
+            continue;
+        // Pages that failed to be created shift the indexes of the others.
+        const QString name = ui_pages.at(i)->attributeName();
+        QWidget *page = containerPage(container, int(i));
+        if (page == nullptr || page->objectName() != name)
+            page = container->findChild<QWidget*>(name);
+        if (page == nullptr)
+            continue;
+        if (m_deferredForm->pageLoader == nullptr)
+            m_deferredForm->pageLoader = new DeferredPageLoader(this);
+        m_deferredForm->pageLoader->addPage(page, holder.take(), m_deferredForm);
+        m_deferredForm->hasDeferredPages = true;
+    }
 }
 
 QWidget *FormBuilderPrivate::create(DomWidget *ui_widget, QWidget *parentWidget)
 {
+    QList<DomWidget *> deferredContents;
+    if (m_deferredForm && isPageContainerClass(ui_widget->attributeClass()))
+        deferredContents = deferPageContents(ui_widget);
+
     QWidget *w = QFormBuilder::create(ui_widget, parentWidget);
+    if (!deferredContents.isEmpty()) {
+        if (w != nullptr)
+            registerDeferredPages(w, ui_widget->elementWidget(), deferredContents);
+        else
+            qDeleteAll(deferredContents);
+    }
     if (w == nullptr)
         return nullptr;
 
@@ -465,6 +784,46 @@ QWidget *FormBuilderPrivate::create(DomWidget *ui_widget, QWidget *parentWidget)
     return w;
 }
 
+// Loads \a file through a binary copy of its DomUI tree in \a cacheDirectory.
+// The copy starts with a hash of the contents it was made from, so it is
+// written again whenever the file changed, however little time passed.
+QWidget *FormBuilderPrivate::loadCached(QFile *file, const QString &cacheDirectory,
+                                        QWidget *parentWidget)
+{
+    d->m_errorString.clear();
+    const QByteArray contents = file->readAll();
+    const QByteArray contentHash = QCryptographicHash::hash(contents, QCryptographicHash::Sha1);
+    const QByteArray key = QCryptographicHash::hash(QFileInfo(*file).absoluteFilePath().toUtf8(),
+                                                    QCryptographicHash::Sha1).toHex();
+    const QString cacheFileName = cacheDirectory + QLatin1Char('/')
+            + QLatin1String(key) + QLatin1String(".uib");
+
+    QScopedPointer<DomUI> ui;
+    QFile cacheFile(cacheFileName);
+    if (cacheFile.open(QIODevice::ReadOnly) && cacheFile.read(contentHash.size()) == contentHash)
+        ui.reset(QUiBinaryFormat::read(&cacheFile));
+
+    if (ui.isNull()) {
+        QBuffer buffer;
+        buffer.setData(contents);
+        buffer.open(QIODevice::ReadOnly);
+        ui.reset(d->readUi(&buffer));
+        if (ui.isNull())
+            return nullptr;
+        QSaveFile newCacheFile(cacheFileName);
+        if (QDir().mkpath(cacheDirectory) && newCacheFile.open(QIODevice::WriteOnly)
+            && newCacheFile.write(contentHash) == contentHash.size()
+            && QUiBinaryFormat::write(ui.data(), &newCacheFile)) {
+            newCacheFile.commit();
+        }
+    }
+
+    QWidget *widget = create(ui.data(), parentWidget);
+    if (!widget && d->m_errorString.isEmpty())
+        d->m_errorString = QFormBuilderExtra::msgInvalidUiFile();
+    return widget;
+}
+
 #define TRANSLATE_SUBWIDGET_PROP(mainWidget, attribute, setter, propName) \
     do { \
         if (const DomProperty *p##attribute = attributes.value(strings.attribute)) { \
@@ -520,6 +879,128 @@ bool FormBuilderPrivate::addItem(DomWidget *ui_widget, QWidget *widget, QWidget
     return true;
 }
 
+// Creates the deferred \a contents of \a page in the context of the
+// form it was loaded with.
+void FormBuilderPrivate::loadDeferredPage(QWidget *page, DomWidget *contents,
+                                          const QSharedPointer<DeferredForm> &form)
+{
+    d->clear();
+    // Only the form's top level widget has its geometry reduced to a size,
+    // so the page must not be taken for it.
+    d->setParentWidget(form->parentWidget);
+    d->m_defaultMargin = form->defaultMargin;
+    d->m_defaultSpacing = form->defaultSpacing;
+    m_class = form->className;
+    m_idBased = form->idBased;
+    m_trwatch = form->translationWatcher.data();
+    setTextBuilder(new TranslatingTextBuilder(m_idBased, trEnabled, m_class));
+    if (!form->customWidgets.isNull())
+        initialize(form->customWidgets.data());
+
+    const QSharedPointer<DeferredForm> savedForm = m_deferredForm;
+    m_deferredForm = form;
+
+    QWidgetList children;
+    const auto &elementWidget = contents->elementWidget();
+    for (DomWidget *ui_child : elementWidget) {
+        if (QWidget *child = create(ui_child, page))
+            children += child;
+    }
+
+    const auto &elementLayout = contents->elementLayout();
+    for (DomLayout *ui_lay : elementLayout)
+        QFormBuilder::create(ui_lay, nullptr, page);
+
+    const QStringList zOrderNames = contents->elementZOrder();
+    if (!zOrderNames.isEmpty()) {
+        QWidgetList zOrder = qvariant_cast<QWidgetList>(page->property("_q_zOrder"));
+        for (const QString &widgetName : zOrderNames) {
+            if (QWidget *child = page->findChild<QWidget*>(widgetName)) {
+                if (child->parentWidget() == page) {
+                    zOrder.removeAll(child);
+                    zOrder.append(child);
+                    child->raise();
+                }
+            }
+        }
+        page->setProperty("_q_zOrder", QVariant::fromValue(zOrder));
+    }
+
+    d->applyInternalProperties();
+    reset();
+    d->clear();
+    m_deferredForm = savedForm;
+
+    // The page is being shown, show the children as if they had been
+    // there before.
+    for (QWidget *child : qAsConst(children)) {
+        if (!child->testAttribute(Qt::WA_WState_ExplicitShowHide))
+            child->show();
+    }
+}
+
+FormBuilderPrivate::~FormBuilderPrivate()
+{
+    for (const QPointer<DeferredPageLoader> &pageLoader : qAsConst(m_pageLoaders)) {
+        if (!pageLoader.isNull())
+            pageLoader->detachBuilder();
+    }
+}
+
+DeferredPageLoader::~DeferredPageLoader()
+{
+    for (const Page &page : qAsConst(m_pages))
+        delete page.contents;
+}
+
+void DeferredPageLoader::addPage(QWidget *page, DomWidget *contents,
+                                 const QSharedPointer<DeferredForm> &form)
+{
+    m_pages.insert(page, Page{contents, form});
+    page->installEventFilter(this);
+    connect(page, &QObject::destroyed, this, [this](QObject *o) {
+        const auto it = m_pages.find(o);
+        if (it != m_pages.end()) {
+            delete it->contents;
+            m_pages.erase(it);
+        }
+    });
+}
+
+// Called when the builder of the loader is destroyed. Keeps its settings
+// to create the remaining pages.
+void DeferredPageLoader::detachBuilder()
+{
+    m_pluginPaths = m_builder->pluginPaths();
+    m_workingDirectory = m_builder->workingDirectory();
+    m_trEnabled = m_builder->trEnabled;
+    m_dynamicTr = m_builder->dynamicTr;
+    m_builder = nullptr;
+}
+
+void DeferredPageLoader::loadPage(QWidget *page)
+{
+    if (m_builder == nullptr) {
+        m_ownBuilder.reset(new FormBuilderPrivate);
+        m_ownBuilder->setPluginPath(m_pluginPaths);
+        m_ownBuilder->setWorkingDirectory(m_workingDirectory);
+        m_ownBuilder->trEnabled = m_trEnabled;
+        m_ownBuilder->dynamicTr = m_dynamicTr;
+        m_builder = m_ownBuilder.data();
+    }
+    const Page entry = m_pages.take(page);
+    page->removeEventFilter(this);
+    QScopedPointer<DomWidget> contents(entry.contents);
+    m_builder->loadDeferredPage(page, contents.data(), entry.form);
+}
+
+bool DeferredPageLoader::eventFilter(QObject *o, QEvent *event)
+{
+    if (event->type() == QEvent::Show && m_pages.contains(o))
+        loadPage(static_cast<QWidget *>(o));
+    return false;
+}
+
 #ifdef QFORMINTERNAL_NAMESPACE
 }
 #endif
@@ -532,6 +1013,7 @@ public:
 #else
     FormBuilderPrivate builder;
 #endif
+    QString cacheDirectory;
 
     void setupWidgetMap() const;
 };
@@ -651,8 +1133,15 @@ QWidget *QUiLoader::load(QIODevice *device, QWidget *parentWidget)
 {
     Q_D(QUiLoader);
     // QXmlStreamReader will report errors on open failure.
-    if (!device->isOpen())
-        device->open(QIODevice::ReadOnly|QIODevice::Text);
+    if (!device->isOpen()) {
+        device->open(QIODevice::ReadOnly);
+        if (!QUiBinaryFormat::canRead(device))
+            device->setTextModeEnabled(true);
+    }
+    if (!d->cacheDirectory.isEmpty()) {
+        if (QFile *file = qobject_cast<QFile *>(device))
+            return d->builder.loadCached(file, d->cacheDirectory, parentWidget);
+    }
     return d->builder.load(device, parentWidget);
 }
 
@@ -832,6 +1321,84 @@ QDir QUiLoader::workingDirectory() const
     Q_D(const QUiLoader);
     return d->builder.workingDirectory();
 }
+/*!
+    \since 6.5
+
+    Sets the directory in which the loader caches the forms it loads from
+    files to \a path. A form loaded from a QFile is stored there in a
+    binary format the first time, and read from the binary copy as long as
+    the file does not change. This avoids parsing the XML of forms that are
+    loaded on every start of an application.
+
+    The cache is disabled if \a path is empty, which is the default.
+
+    \sa cacheDirectory(), load()
+*/
+
+void QUiLoader::setCacheDirectory(const QString &path)
+{
+    Q_D(QUiLoader);
+    d->cacheDirectory = path;
+}
+
+/*!
+    \since 6.5
+
+    Returns the directory in which loaded forms are cached.
+
+    \sa setCacheDirectory()
+*/
+
+QString QUiLoader::cacheDirectory() const
+{
+    Q_D(const QUiLoader);
+    return d->cacheDirectory;
+}
+
+/*!
+    \since 6.5
+
+    If \a enabled is true, the loader creates only the current page of the
+    QTabWidget, QStackedWidget and QToolBox instances of a form. The child
+    widgets and layouts of the other pages are created when the page is
+    shown for the first time, which makes loading forms with many pages
+    faster.
+
+    Pages containing actions, button groups or widgets that are referenced
+    from outside of the page by connections, tab stops or buddies are
+    always created right away. The widgets of a page that has not been
+    shown yet cannot be found with QObject::findChild().
+
+    Pages that are shown after the loader was destroyed are created
+    without it, with the plugin paths, working directory and translation
+    settings it had. Reimplementations of createWidget(), createLayout(),
+    createAction() and createActionGroup() are then not called for their
+    contents. The default is false.
+
+    \sa isDeferredPageLoadingEnabled(), load()
+*/
+
+void QUiLoader::setDeferredPageLoadingEnabled(bool enabled)
+{
+    Q_D(QUiLoader);
+    d->builder.deferredPageLoading = enabled;
+}
+
+/*!
+    \since 6.5
+
+    Returns true if the contents of inactive pages are created when the
+    pages are shown for the first time; returns false otherwise.
+
+    \sa setDeferredPageLoadingEnabled()
+*/
+
+bool QUiLoader::isDeferredPageLoadingEnabled() const
+{
+    Q_D(const QUiLoader);
+    return d->builder.deferredPageLoading;
+}
+
 /*!
     \since 4.5
 
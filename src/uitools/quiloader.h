@@ -42,6 +42,12 @@ public:
     void setWorkingDirectory(const QDir &dir);
     QDir workingDirectory() const;
 
+    void setCacheDirectory(const QString &path);
+    QString cacheDirectory() const;
+
+    void setDeferredPageLoadingEnabled(bool enabled);
+    bool isDeferredPageLoadingEnabled() const;
+
     void setLanguageChangeEnabled(bool enabled);
     bool isLanguageChangeEnabled() const;
 
@@ -0,0 +1,12 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtCore/QObject>
+
+class Helper : public QObject
+{
+    Q_OBJECT
+
+public:
+    QString text() { return tr("Help text"); }
+};
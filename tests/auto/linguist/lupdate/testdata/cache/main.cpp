@@ -0,0 +1,23 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtCore/QObject>
+
+#include "dialog.h"
+
+// Included inside a namespace, so it is parsed as part of this file.
+namespace Inlined {
+#include "direct.h"
+}
+
+void Dialog::open()
+{
+    tr("Open the dialog");
+}
+
+void Dialog::close()
+{
+    // Makes lupdate print a warning, which is repeated for cached files.
+    //% "Close"
+    tr("Close the dialog");
+}
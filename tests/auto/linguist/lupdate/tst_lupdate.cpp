@@ -11,6 +11,7 @@
 #include <QtCore/QFile>
 #include <QtCore/private/qconfig_p.h>
 #include <QtCore/QSet>
+#include <QtCore/QTemporaryDir>
 
 #include <QtTest/QtTest>
 #include <QtTools/private/qttools-config_p.h>
@@ -26,6 +27,7 @@ public:
 private slots:
     void good_data();
     void good();
+    void cache();
 #if CHECK_SIMTEXTH
     void simtexth();
     void simtexth_data();
@@ -35,6 +37,7 @@ private:
     QString m_cmdLupdate;
     QString m_basePath;
 
+    bool runLupdate(const QString &workDir, const QStringList &arguments, QString *output);
     void doCompare(QStringList actual, const QString &expectedFn, bool err);
     void doCompare(const QString &actualFn, const QString &expectedFn, bool err);
 };
@@ -331,6 +334,93 @@ void tst_lupdate::good()
     }
 }
 
+bool tst_lupdate::runLupdate(const QString &workDir, const QStringList &arguments,
+                             QString *output)
+{
+    QProcess proc;
+    proc.setWorkingDirectory(workDir);
+    proc.setProcessChannelMode(QProcess::MergedChannels);
+    proc.start(m_cmdLupdate, QStringList(QLatin1String("-silent")) + arguments);
+    if (!proc.waitForStarted() || !proc.waitForFinished(30000)) {
+        *output = proc.errorString();
+        return false;
+    }
+    *output = QString::fromLocal8Bit(proc.readAll());
+    return proc.exitStatus() == QProcess::NormalExit && !proc.exitCode();
+}
+
+static QByteArray readFile(const QString &fileName)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+// Runs lupdate with and without a cache and checks that cached runs
+// produce the same .ts files and warnings, also after an included header
+// changed.
+void tst_lupdate::cache()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString workDir = tempDir.path();
+    const QStringList sources{ "main.cpp", "dialog.h", "direct.h" };
+    for (const QString &source : sources) {
+        QVERIFY(QFile::copy(m_basePath + "cache/" + source, workDir + '/' + source));
+        QVERIFY(QFile::setPermissions(workDir + '/' + source,
+                                      QFile::ReadOwner | QFile::WriteOwner));
+    }
+    const QStringList cacheArguments{ "-cache-dir", workDir + "/cache" };
+
+    const QString warning = QStringLiteral("//% cannot be used with tr()");
+    QString output;
+    const auto run = [&](const QString &ts, bool useCache) {
+        QFile::remove(workDir + '/' + ts);
+        const QStringList arguments = (useCache ? cacheArguments : QStringList()) + sources
+                + QStringList{ "-ts", ts };
+        const bool ok = runLupdate(workDir, arguments, &output);
+        QVERIFY2(ok, qPrintable(output));
+    };
+
+    run("uncached.ts", false);
+    QVERIFY(!QTest::currentTestFailed());
+    const QByteArray expected = readFile(workDir + "/uncached.ts");
+    QCOMPARE(output.count(warning), 1);
+    QVERIFY(expected.contains("<name>Inlined::Helper</name>"));
+    // direct.h is parsed as part of main.cpp, which blacklists it.
+    QVERIFY(!expected.contains("<name>Helper</name>"));
+
+    // The first run fills the cache, the second one takes main.cpp from it
+    // and must still blacklist direct.h.
+    run("cold.ts", true);
+    QVERIFY(!QTest::currentTestFailed());
+    QCOMPARE(readFile(workDir + "/cold.ts"), expected);
+    QCOMPARE(output.count(warning), 1);
+    QVERIFY(!QDir(workDir + "/cache").isEmpty());
+    run("warm.ts", true);
+    QVERIFY(!QTest::currentTestFailed());
+    QCOMPARE(readFile(workDir + "/warm.ts"), expected);
+    QCOMPARE(output.count(warning), 1);
+
+    // Changing direct.h invalidates the entry of main.cpp, which includes it.
+    QFile header(workDir + "/direct.h");
+    QVERIFY(header.open(QIODevice::ReadOnly));
+    QByteArray contents = header.readAll();
+    header.close();
+    QVERIFY(contents.contains("\"Help text\""));
+    contents.replace("\"Help text\"", "\"Updated help text\"");
+    QVERIFY(header.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QCOMPARE(header.write(contents), contents.size());
+    header.close();
+
+    run("uncached-edited.ts", false);
+    QVERIFY(!QTest::currentTestFailed());
+    const QByteArray expectedEdited = readFile(workDir + "/uncached-edited.ts");
+    QVERIFY(expectedEdited.contains("Updated help text"));
+    run("warm-edited.ts", true);
+    QVERIFY(!QTest::currentTestFailed());
+    QCOMPARE(readFile(workDir + "/warm-edited.ts"), expectedEdited);
+}
+
 #if CHECK_SIMTEXTH
 void tst_lupdate::simtexth()
 {
@@ -0,0 +1,165 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "simtexth.h"
+#include "translator.h"
+
+#include <QtTest/QtTest>
+
+class tst_SimTextH : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void similarityScore_data();
+    void similarityScore();
+    void indexCandidates_data();
+    void indexCandidates();
+    void indexUpdates();
+    void heuristicCandidates();
+};
+
+static QStringList sources(const CandidateList &candidates)
+{
+    QStringList result;
+    for (const Candidate &candidate : candidates)
+        result.append(candidate.source);
+    return result;
+}
+
+static QStringList descriptions(const CandidateList &candidates)
+{
+    QStringList result;
+    for (const Candidate &candidate : candidates) {
+        QString description = candidate.context + QLatin1Char('/') + candidate.source;
+        if (!candidate.disambiguation.isEmpty())
+            description += QLatin1String(" (") + candidate.disambiguation + QLatin1Char(')');
+        result.append(description);
+    }
+    return result;
+}
+
+void tst_SimTextH::similarityScore_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<QString>("t");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("equal") << "Quit" << "Quit" << 1024;
+    QTest::newRow("empty") << QString() << QString() << 1024;
+    QTest::newRow("plural") << "Open File" << "Open Files" << 787;
+    QTest::newRow("other verb") << "Open File" << "Save File" << 341;
+    QTest::newRow("here and hither") << "here" << "hither" << 341;
+    QTest::newRow("punctuation") << "&Open..." << "Open" << 240;
+    QTest::newRow("different") << "Open" << "Close" << 85;
+}
+
+// The scores are those of the previous table based bit counting.
+void tst_SimTextH::similarityScore()
+{
+    QFETCH(QString, s);
+    QFETCH(QString, t);
+    QFETCH(int, expected);
+
+    QCOMPARE(getSimilarityScore(s, t), expected);
+    QCOMPARE(getSimilarityScore(t, s), expected);
+}
+
+void tst_SimTextH::indexCandidates_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("maxCandidates");
+    QTest::addColumn<QStringList>("expected");
+
+    const QStringList all = { "A/Open File", "A/Open File (menu)", "B/Open Files",
+                              "A/Open Files", "A/Save File" };
+    QTest::newRow("none") << "Open File" << 0 << QStringList();
+    QTest::newRow("one") << "Open File" << 1 << all.mid(0, 1);
+    QTest::newRow("tie at the cut") << "Open File" << 2 << all.mid(0, 2);
+    QTest::newRow("tie at the cut, lower score") << "Open File" << 3 << all.mid(0, 3);
+    QTest::newRow("all") << "Open File" << 5 << all;
+    QTest::newRow("more than all") << "Open File" << 100 << all;
+    QTest::newRow("ties below the best")
+            << "Save File" << 100
+            << QStringList{ "A/Save File", "A/Open File", "A/Open File (menu)", "B/Open Files",
+                            "A/Open Files" };
+    QTest::newRow("others below threshold") << "Quit" << 100 << QStringList{ "A/Quit" };
+    QTest::newRow("no match") << "Print" << 100 << QStringList();
+}
+
+// The index returns the distinct candidates scoring at least the
+// threshold, best first and equal scores in index order.
+void tst_SimTextH::indexCandidates()
+{
+    QFETCH(QString, text);
+    QFETCH(int, maxCandidates);
+    QFETCH(QStringList, expected);
+
+    // "Open File" scores 1024, 787, 341 and 42 against "Open File",
+    // "Open Files", "Save File" and "Quit". The candidate at 4 is a
+    // duplicate of the one at 2.
+    SimilarTextIndex index;
+    index.resize(8);
+    index.setCandidate(0, Candidate("B", "Open Files", QString(), "Dateien öffnen"));
+    index.setCandidate(1, Candidate("A", "Save File", QString(), "Datei speichern"));
+    index.setCandidate(2, Candidate("A", "Open File", QString(), "Datei öffnen"));
+    index.setCandidate(3, Candidate("A", "Open Files", QString(), "Dateien öffnen"));
+    index.setCandidate(4, Candidate("A", "Open File", QString(), "Datei öffnen"));
+    index.setCandidate(5, Candidate("A", "Quit", QString(), "Beenden"));
+    index.setCandidate(6, Candidate("A", "Open File", "menu", "Datei öffnen"));
+    // There is no candidate at 7.
+
+    QCOMPARE(descriptions(index.candidates(text, maxCandidates)), expected);
+}
+
+void tst_SimTextH::indexUpdates()
+{
+    SimilarTextIndex index;
+    index.resize(3);
+    index.setCandidate(0, Candidate("C", "Open File", QString(), "Datei öffnen"));
+    index.setCandidate(2, Candidate("C", "Open Files", QString(), "Dateien öffnen"));
+    QCOMPARE(sources(index.candidates("Open File", 10)),
+             QStringList({ "Open File", "Open Files" }));
+
+    // Replacing and removing entries affects only those.
+    index.setCandidate(0, Candidate("C", "Quit", QString(), "Beenden"));
+    QCOMPARE(sources(index.candidates("Open File", 10)), QStringList("Open Files"));
+    index.setCandidate(1, Candidate("C", "Open File", QString(), "Datei öffnen"));
+    QCOMPARE(sources(index.candidates("Open File", 10)),
+             QStringList({ "Open File", "Open Files" }));
+    index.removeCandidate(1);
+    QCOMPARE(sources(index.candidates("Open File", 10)), QStringList("Open Files"));
+    QCOMPARE(sources(index.candidates("Quit", 10)), QStringList("Quit"));
+
+    index.resize(1);
+    QCOMPARE(index.count(), 1);
+    QVERIFY(index.candidates("Open File", 10).isEmpty());
+    QCOMPARE(sources(index.candidates("Quit", 10)), QStringList("Quit"));
+}
+
+void tst_SimTextH::heuristicCandidates()
+{
+    Translator tor;
+    const auto add = [&tor](const QString &source, const QString &translation,
+                            TranslatorMessage::Type type) {
+        tor.append(TranslatorMessage("C", source, QString(), QString(), "a.cpp", 1,
+                                     QStringList(translation), type));
+    };
+    add("Open Files", "Dateien öffnen", TranslatorMessage::Finished);
+    add("Open File", "Datei öffnen", TranslatorMessage::Unfinished);
+    add("Open File", QString(), TranslatorMessage::Finished);
+    add("Open File", "Datei öffnen", TranslatorMessage::Obsolete);
+    add("Save File", "Datei speichern", TranslatorMessage::Vanished);
+    add("Quit", "Beenden", TranslatorMessage::Finished);
+
+    // Unfinished and untranslated messages are no candidates.
+    const CandidateList candidates = similarTextHeuristicCandidates(&tor, "Open File", 5);
+    QCOMPARE(sources(candidates), QStringList({ "Open File", "Open Files", "Save File" }));
+    QCOMPARE(candidates.constFirst().translation, QStringLiteral("Datei öffnen"));
+    QCOMPARE(sources(similarTextHeuristicCandidates(&tor, "Open File", 1)),
+             QStringList("Open File"));
+}
+
+QTEST_APPLESS_MAIN(tst_SimTextH)
+
+#include "tst_simtexth.moc"
@@ -0,0 +1,364 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "translator.h"
+
+#include <QtTest/QtTest>
+
+class tst_Translator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void appendSorted();
+    void appendSortedCases_data();
+    void appendSortedCases();
+    void appendSortedBatch_data();
+    void appendSortedBatch();
+    void findByReferences();
+    void findByReferencesAfterReplace();
+    void findByReferencesAfterRemoval();
+};
+
+static TranslatorMessage message(const QString &fileName, const QString &context, int lineNumber,
+                                 const QString &sourceText)
+{
+    return TranslatorMessage(context, sourceText, QString(), QString(), fileName, lineNumber);
+}
+
+static QStringList sourceTexts(const QList<TranslatorMessage> &messages)
+{
+    QStringList result;
+    for (const TranslatorMessage &msg : messages)
+        result.append(msg.sourceText());
+    return result;
+}
+
+/*
+  The placement of a single message as it was done by scanning all
+  messages, before messages were placed in batches.
+*/
+static void referenceAppendSorted(QList<TranslatorMessage> *messages,
+                                  const TranslatorMessage &msg)
+{
+    const int msgLine = msg.lineNumber();
+    if (msgLine < 0) {
+        messages->append(msg);
+        return;
+    }
+
+    int bestIdx = 0;
+    int bestScore = 0;
+    int bestSize = 0;
+    int thisIdx = 0;
+    int thisScore = 0;
+    int thisSize = 0;
+    int prevLine = 0;
+    int curIdx = 0;
+    for (const TranslatorMessage &mit : std::as_const(*messages)) {
+        const bool sameFile = mit.fileName() == msg.fileName() && mit.context() == msg.context();
+        int curLine;
+        if (sameFile && (curLine = mit.lineNumber()) >= prevLine) {
+            if (msgLine >= prevLine && msgLine < curLine) {
+                thisIdx = curIdx;
+                thisScore = thisSize ? 2 : 1;
+            }
+            ++thisSize;
+            prevLine = curLine;
+        } else if (thisSize) {
+            if (!thisScore) {
+                thisIdx = curIdx;
+                thisScore = 1;
+            }
+            if (thisScore > bestScore || (thisScore == bestScore && thisSize > bestSize)) {
+                bestIdx = thisIdx;
+                bestScore = thisScore;
+                bestSize = thisSize;
+            }
+            thisScore = 0;
+            thisSize = sameFile ? 1 : 0;
+            prevLine = 0;
+        }
+        ++curIdx;
+    }
+    if (thisSize && !thisScore) {
+        thisIdx = curIdx;
+        thisScore = 1;
+    }
+    if (thisScore > bestScore || (thisScore == bestScore && thisSize > bestSize))
+        messages->insert(thisIdx, msg);
+    else if (bestScore)
+        messages->insert(bestIdx, msg);
+    else
+        messages->append(msg);
+}
+
+void tst_Translator::appendSorted()
+{
+    Translator tor;
+    tor.append(message("a.cpp", "A", 10, "ten"));
+    tor.append(message("a.cpp", "A", 20, "twenty"));
+    tor.append(message("b.cpp", "B", 10, "other"));
+    tor.append(message("a.cpp", "A", 30, "thirty"));
+
+    tor.appendSorted(message("a.cpp", "A", 15, "fifteen"));
+    tor.appendSorted(message("a.cpp", "A", 5, "five"));
+    tor.appendSorted(message("a.cpp", "A", 40, "forty"));
+    tor.appendSorted(message("c.cpp", "C", 1, "new file"));
+    tor.appendSorted(message("a.cpp", "A", -1, "no line"));
+
+    // "forty" follows the longest run of ascending lines of its file and
+    // context, not the last message of them.
+    const QStringList expected = { "five", "ten", "fifteen", "twenty", "forty", "other",
+                                   "thirty", "new file", "no line" };
+    QCOMPARE(sourceTexts(tor.messages()), expected);
+}
+
+/*
+  Messages are given as "<file>[<context>]:<line>[ <tag>]", where the
+  file "a" stands for "a.cpp" and the context defaults to "X". The
+  whole string is the source text of the message.
+*/
+static TranslatorMessage message(const QString &spec)
+{
+    const QString location = spec.section(QLatin1Char(' '), 0, 0);
+    const QString file = location.section(QLatin1Char(':'), 0, 0);
+    const int line = location.section(QLatin1Char(':'), 1).toInt();
+    return message(file.left(1) + QLatin1String(".cpp"),
+                   file.size() > 1 ? file.mid(1) : QStringLiteral("X"), line, spec);
+}
+
+void tst_Translator::appendSortedCases_data()
+{
+    QTest::addColumn<QStringList>("existing");
+    QTest::addColumn<QStringList>("added");
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("empty") << QStringList() << QStringList{ "a:10" } << QStringList{ "a:10" };
+    QTest::newRow("before all") << QStringList{ "a:10" } << QStringList{ "a:5" }
+                                << QStringList{ "a:5", "a:10" };
+    QTest::newRow("after all") << QStringList{ "a:10" } << QStringList{ "a:20" }
+                               << QStringList{ "a:10", "a:20" };
+    QTest::newRow("same line") << QStringList{ "a:10", "a:20" } << QStringList{ "a:10 new" }
+                               << QStringList{ "a:10", "a:10 new", "a:20" };
+    QTest::newRow("inside") << QStringList{ "a:10", "a:20" } << QStringList{ "a:15" }
+                            << QStringList{ "a:10", "a:15", "a:20" };
+    QTest::newRow("inside wins over longer region")
+            << QStringList{ "a:10", "a:20", "b:1", "a:30", "a:40", "a:50" }
+            << QStringList{ "a:15" }
+            << QStringList{ "a:10", "a:15", "a:20", "b:1", "a:30", "a:40", "a:50" };
+    QTest::newRow("longer region wins")
+            << QStringList{ "a:10", "b:1", "a:20", "a:30" } << QStringList{ "a:5" }
+            << QStringList{ "a:10", "b:1", "a:5", "a:20", "a:30" };
+    QTest::newRow("equal regions, first wins")
+            << QStringList{ "a:10", "a:20", "b:1", "a:30", "a:40" } << QStringList{ "a:5" }
+            << QStringList{ "a:5", "a:10", "a:20", "b:1", "a:30", "a:40" };
+    QTest::newRow("equal regions, inside both")
+            << QStringList{ "a:10", "a:20", "b:1", "a:10 second", "a:20 second" }
+            << QStringList{ "a:15" }
+            << QStringList{ "a:10", "a:15", "a:20", "b:1", "a:10 second", "a:20 second" };
+    QTest::newRow("non-adjacent region")
+            << QStringList{ "a:10", "a:20", "b:1", "b:2", "b:3", "a:30", "a:40", "a:50" }
+            << QStringList{ "a:35" }
+            << QStringList{ "a:10", "a:20", "b:1", "b:2", "b:3", "a:30", "a:35", "a:40",
+                            "a:50" };
+    QTest::newRow("descending line breaks region")
+            << QStringList{ "a:30", "a:10", "a:20" } << QStringList{ "a:15" }
+            << QStringList{ "a:30", "a:10", "a:15", "a:20" };
+    QTest::newRow("other context") << QStringList{ "a:10", "aY:20", "a:30" }
+                                   << QStringList{ "aY:25" }
+                                   << QStringList{ "a:10", "aY:20", "aY:25", "a:30" };
+    QTest::newRow("new file") << QStringList{ "a:10", "b:10" } << QStringList{ "c:1" }
+                              << QStringList{ "a:10", "b:10", "c:1" };
+    QTest::newRow("no line") << QStringList{ "a:10", "b:10" } << QStringList{ "a:-1" }
+                             << QStringList{ "a:10", "b:10", "a:-1" };
+    QTest::newRow("batch") << QStringList{ "a:10", "a:20" }
+                           << QStringList{ "a:15", "a:12", "a:18" }
+                           << QStringList{ "a:10", "a:12", "a:15", "a:18", "a:20" };
+    QTest::newRow("batch, new region") << QStringList{ "a:10" }
+                                       << QStringList{ "b:5", "b:1", "b:9" }
+                                       << QStringList{ "a:10", "b:1", "b:5", "b:9" };
+}
+
+void tst_Translator::appendSortedCases()
+{
+    QFETCH(QStringList, existing);
+    QFETCH(QStringList, added);
+    QFETCH(QStringList, expected);
+
+    Translator one;
+    Translator batch;
+    QList<TranslatorMessage> addedMessages;
+    for (const QString &spec : std::as_const(existing)) {
+        one.append(message(spec));
+        batch.append(message(spec));
+    }
+    for (const QString &spec : std::as_const(added)) {
+        one.appendSorted(message(spec));
+        addedMessages.append(message(spec));
+    }
+    batch.appendSorted(addedMessages);
+
+    QCOMPARE(sourceTexts(one.messages()), expected);
+    QCOMPARE(sourceTexts(batch.messages()), expected);
+}
+
+void tst_Translator::appendSortedBatch_data()
+{
+    QTest::addColumn<bool>("indexed");
+    QTest::addColumn<bool>("batch");
+
+    QTest::newRow("one by one") << false << false;
+    QTest::newRow("one by one, indexed") << true << false;
+    QTest::newRow("batch") << false << true;
+    QTest::newRow("batch, indexed") << true << true;
+}
+
+// Every combination of up to four existing and two added messages, drawn
+// from a few lines of two contexts, is placed as by the scan over all
+// messages, and the message index stays valid.
+void tst_Translator::appendSortedBatch()
+{
+    QFETCH(bool, indexed);
+    QFETCH(bool, batch);
+
+    const QStringList existingSpecs = { "a:10", "a:20", "a:30", "aY:20" };
+    const QStringList addedSpecs = { "a:5", "a:15", "a:25", "a:35", "aY:25", "a:-1" };
+
+    QList<QList<int>> bases = { {} };
+    for (qsizetype first = 0; first < bases.size(); ++first) {
+        if (bases.at(first).size() == 4)
+            continue;
+        for (int i = 0; i < existingSpecs.size(); ++i)
+            bases.append(bases.at(first) + QList<int>{ i });
+    }
+
+    for (const QList<int> &base : std::as_const(bases)) {
+        for (const QString &firstSpec : addedSpecs) {
+            for (const QString &secondSpec : addedSpecs) {
+                // Source texts are unique, so that the message index can be checked.
+                int serial = 0;
+                Translator tor;
+                QList<TranslatorMessage> expected;
+                for (int i : base) {
+                    const TranslatorMessage msg =
+                            message(existingSpecs.at(i) + QLatin1Char(' ')
+                                    + QString::number(++serial));
+                    tor.append(msg);
+                    expected.append(msg);
+                }
+                if (indexed && !expected.isEmpty())
+                    QCOMPARE(tor.find(expected.constFirst()), 0);
+
+                const QList<TranslatorMessage> added = {
+                    message(firstSpec + QLatin1Char(' ') + QString::number(++serial)),
+                    message(secondSpec + QLatin1Char(' ') + QString::number(++serial))
+                };
+                for (const TranslatorMessage &msg : added)
+                    referenceAppendSorted(&expected, msg);
+                if (batch) {
+                    tor.appendSorted(added);
+                } else {
+                    for (const TranslatorMessage &msg : added)
+                        tor.appendSorted(msg);
+                }
+
+                QCOMPARE(sourceTexts(tor.messages()), sourceTexts(expected));
+                for (int i = 0; i < expected.size(); ++i)
+                    QCOMPARE(tor.find(expected.at(i)), i);
+            }
+        }
+    }
+}
+
+static TranslatorMessage::References references(const QStringList &specs)
+{
+    TranslatorMessage::References result;
+    for (const QString &spec : specs) {
+        result.append(TranslatorMessage::Reference(spec.section(QLatin1Char(':'), 0, 0),
+                                                   spec.section(QLatin1Char(':'), 1).toInt()));
+    }
+    return result;
+}
+
+static TranslatorMessage referencedMessage(const QString &context, const QString &sourceText,
+                                           const QString &comment, const QStringList &refs)
+{
+    TranslatorMessage msg(context, sourceText, comment, QString(), QString(), -1);
+    msg.setReferences(references(refs));
+    return msg;
+}
+
+void tst_Translator::findByReferences()
+{
+    Translator tor;
+    tor.append(referencedMessage("X", "one", QString(), { "a.cpp:1", "b.cpp:7" }));
+    tor.append(referencedMessage("X", "two", "c", { "a.cpp:2" }));
+    tor.append(referencedMessage("Y", "three", QString(), { "a.cpp:1" }));
+    tor.append(referencedMessage("X", "four", QString(), { "a.cpp:1", "a.cpp:4" }));
+
+    QCOMPARE(tor.find("X", QString(), references({})), -1);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:9" })), -1);
+    QCOMPARE(tor.find("X", QString(), references({ "b.cpp:7" })), 0);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:4" })), 3);
+
+    // The lowest position wins, whichever reference matches it.
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), 0);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:4", "b.cpp:7" })), 0);
+
+    // Context and comment must match as well.
+    QCOMPARE(tor.find("Y", QString(), references({ "a.cpp:1" })), 2);
+    QCOMPARE(tor.find("X", "c", references({ "a.cpp:2" })), 1);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:2" })), -1);
+
+    // References added to an existing message are found, and positions
+    // shift when a message is placed among the others.
+    ConversionData cd;
+    tor.extend(TranslatorMessage("X", "two", "c", QString(), "b.cpp", 3), cd);
+    QVERIFY(cd.errors().isEmpty());
+    QCOMPARE(tor.find("X", "c", references({ "b.cpp:3" })), 1);
+    tor.appendSorted(TranslatorMessage("X", "one and a half", QString(), QString(), "a.cpp", 1));
+    QCOMPARE(tor.message(1).sourceText(), QStringLiteral("one and a half"));
+    QCOMPARE(tor.find("X", "c", references({ "b.cpp:3" })), 2);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:4" })), 4);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), 0);
+}
+
+// A message replaced in place leaves its old references in the index,
+// which must not match any more.
+void tst_Translator::findByReferencesAfterReplace()
+{
+    Translator tor;
+    tor.append(referencedMessage("X", "one", QString(), { "a.cpp:1" }));
+    tor.append(referencedMessage("X", "two", QString(), { "a.cpp:2", "a.cpp:1" }));
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), 0);
+
+    tor.replaceSorted(referencedMessage("X", "one", QString(), { "a.cpp:5" }));
+    QCOMPARE(tor.messageCount(), 2);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:5" })), 0);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), 1);
+
+    tor.replaceSorted(referencedMessage("X", "two", QString(), { "a.cpp:2" }));
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), -1);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:2" })), 1);
+}
+
+void tst_Translator::findByReferencesAfterRemoval()
+{
+    Translator tor;
+    tor.append(referencedMessage("X", "one", QString(), { "a.cpp:1" }));
+    tor.append(referencedMessage("X", "two", QString(), { "a.cpp:2" }));
+    tor.append(referencedMessage("X", "three", QString(), { "a.cpp:3", "a.cpp:1" }));
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:3" })), 2);
+
+    tor.message(0).setType(TranslatorMessage::Obsolete);
+    tor.stripObsoleteMessages();
+    QCOMPARE(tor.messageCount(), 2);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:1" })), 1);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:2" })), 0);
+    QCOMPARE(tor.find("X", QString(), references({ "a.cpp:3" })), 1);
+}
+
+QTEST_APPLESS_MAIN(tst_Translator)
+
+#include "tst_translator.moc"
@@ -0,0 +1,178 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "binaryindex.h"
+
+#include <QtCore/qfile.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qxmlstream.h>
+#include <QtTest/QtTest>
+
+#include <cstddef>
+
+class tst_BinaryIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void sameElementsAsXml();
+    void skipCurrentElement();
+    void invalidFiles();
+
+private:
+    QString writeIndex(const QByteArray &xml);
+
+    QTemporaryDir m_tempDir;
+};
+
+static const char s_smallIndex[] =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<!DOCTYPE QDOCINDEX>\n"
+        "<INDEX project=\"Test\">\n"
+        "    <namespace name=\"\" module=\"test\">\n"
+        "        <class name=\"A\" href=\"a.html\">\n"
+        "            <function name=\"f\" signature=\"void f(int &amp;x)\">\n"
+        "                <parameter type=\"int &amp;\" name=\"x\"/>\n"
+        "            </function>\n"
+        "            <function name=\"g\"/>\n"
+        "        </class>\n"
+        "        <class name=\"B\" href=\"b.html\"/>\n"
+        "    </namespace>\n"
+        "</INDEX>\n";
+
+/*
+  Returns the start and end elements read by \a reader, with the
+  attributes of the start elements, one per line.
+ */
+template<typename Reader>
+static QStringList events(Reader &reader)
+{
+    QStringList result;
+    for (;;) {
+        const QXmlStreamReader::TokenType token = reader.readNext();
+        if (token == QXmlStreamReader::StartElement) {
+            QString event = QLatin1Char('<') + reader.name().toString();
+            for (const QXmlStreamAttribute &attribute : reader.attributes()) {
+                event += QLatin1Char(' ') + attribute.name().toString() + QLatin1String("=\"")
+                        + attribute.value().toString() + QLatin1Char('"');
+            }
+            result.append(event + QLatin1Char('>'));
+        } else if (token == QXmlStreamReader::EndElement) {
+            result.append(QLatin1String("</") + reader.name().toString() + QLatin1Char('>'));
+        } else if (token == QXmlStreamReader::EndDocument
+                   || token == QXmlStreamReader::Invalid) {
+            break;
+        }
+    }
+    return result;
+}
+
+void tst_BinaryIndex::init()
+{
+    QVERIFY(m_tempDir.isValid());
+}
+
+/*
+  Writes \a xml to an index file and converts it. Returns the
+  path of the XML index.
+ */
+QString tst_BinaryIndex::writeIndex(const QByteArray &xml)
+{
+    const QString path = m_tempDir.filePath(QStringLiteral("test.index"));
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(xml) != xml.size())
+        return QString();
+    file.close();
+    return BinaryIndex::write(path) ? path : QString();
+}
+
+void tst_BinaryIndex::sameElementsAsXml()
+{
+    QFile generated(QLatin1String(SRCDIR "/../generatedoutput/expected_output/testcpp.index"));
+    QVERIFY(generated.open(QIODevice::ReadOnly));
+
+    for (const QByteArray &xml : { QByteArray(s_smallIndex), generated.readAll() }) {
+        const QString path = writeIndex(xml);
+        QVERIFY(!path.isEmpty());
+
+        QXmlStreamReader xmlReader(xml);
+        const QStringList expected = events(xmlReader);
+        QVERIFY(!xmlReader.hasError());
+        QVERIFY(expected.size() > 2);
+
+        BinaryIndexReader binaryReader;
+        QVERIFY(binaryReader.open(BinaryIndex::pathForIndexFile(path)));
+        QCOMPARE(events(binaryReader), expected);
+    }
+}
+
+void tst_BinaryIndex::skipCurrentElement()
+{
+    const QString path = writeIndex(s_smallIndex);
+    QVERIFY(!path.isEmpty());
+    BinaryIndexReader reader;
+    QVERIFY(reader.open(BinaryIndex::pathForIndexFile(path)));
+
+    QVERIFY(reader.readNextStartElement());
+    QCOMPARE(reader.name().toString(), QStringLiteral("INDEX"));
+    QVERIFY(reader.readNextStartElement());
+    QCOMPARE(reader.name().toString(), QStringLiteral("namespace"));
+    QVERIFY(reader.readNextStartElement());
+    QCOMPARE(reader.name().toString(), QStringLiteral("class"));
+    QCOMPARE(reader.attributes().value(QLatin1String("name")).toString(), QStringLiteral("A"));
+
+    // Skipping a start element jumps past its descendants.
+    reader.skipCurrentElement();
+    QVERIFY(reader.isEndElement());
+    QVERIFY(reader.readNextStartElement());
+    QCOMPARE(reader.attributes().value(QLatin1String("name")).toString(), QStringLiteral("B"));
+
+    // Skipping from within an element finishes it.
+    QCOMPARE(reader.readNext(), QXmlStreamReader::EndElement);
+    QCOMPARE(reader.name().toString(), QStringLiteral("class"));
+    reader.skipCurrentElement();
+    QVERIFY(reader.isEndElement());
+    QCOMPARE(reader.name().toString(), QStringLiteral("namespace"));
+
+    QCOMPARE(reader.readNext(), QXmlStreamReader::EndElement);
+    QCOMPARE(reader.name().toString(), QStringLiteral("INDEX"));
+    QCOMPARE(reader.readNext(), QXmlStreamReader::EndDocument);
+    QCOMPARE(reader.readNext(), QXmlStreamReader::Invalid);
+}
+
+void tst_BinaryIndex::invalidFiles()
+{
+    QVERIFY(writeIndex("<INDEX><unterminated></INDEX>").isEmpty());
+
+    const QString path = writeIndex(s_smallIndex);
+    QVERIFY(!path.isEmpty());
+    const QString binaryPath = BinaryIndex::pathForIndexFile(path);
+    QFile file(binaryPath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray data = file.readAll();
+    file.close();
+
+    const auto opens = [&binaryPath](const QByteArray &contents) {
+        QFile file(binaryPath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            return false;
+        file.write(contents);
+        file.close();
+        BinaryIndexReader reader;
+        return reader.open(binaryPath);
+    };
+
+    QVERIFY(opens(data));
+    QVERIFY(!opens(data.left(data.size() - 2)));
+    QVERIFY(!opens(data + "xx"));
+    QVERIFY(!opens(QByteArray(s_smallIndex)));
+    QByteArray wrongVersion = data;
+    ++wrongVersion[int(offsetof(BinaryIndex::Header, version))];
+    QVERIFY(!opens(wrongVersion));
+}
+
+QTEST_APPLESS_MAIN(tst_BinaryIndex)
+
+#include "tst_binaryindex.moc"
@@ -7,6 +7,8 @@
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qhash.h>
 #include <QtCore/qstringlist.h>
+#include <QtCore/qtemporarydir.h>
+#include <QtCore/qthread.h>
 #include <QtTest/QtTest>
 
 class tst_Config : public QObject
@@ -21,6 +23,9 @@ private slots:
     void includepaths();
     void getExampleProjectFile();
     void expandVars();
+    void jobs_data();
+    void jobs();
+    void cacheDir();
 
 private:
     Config &initConfig(const QStringList &args = QStringList(),
@@ -175,6 +180,50 @@ void::tst_Config::expandVars()
     QCOMPARE(config.getString("csvlist"), "a,b,c");
 }
 
+void tst_Config::jobs_data()
+{
+    QTest::addColumn<QStringList>("args");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("unset") << QStringList() << 1;
+    QTest::newRow("jobs") << QStringList{ "-jobs", "4" } << 4;
+    QTest::newRow("short") << QStringList{ "-j", "2" } << 2;
+    QTest::newRow("ideal") << QStringList{ "-jobs", "0" } << QThread::idealThreadCount();
+    QTest::newRow("negative") << QStringList{ "-jobs", "-3" } << 1;
+    QTest::newRow("invalid") << QStringList{ "-jobs", "many" } << 1;
+}
+
+void tst_Config::jobs()
+{
+    QFETCH(QStringList, args);
+    QFETCH(int, expected);
+
+    // A previous run with another value must not leak into this one.
+    initConfig({ "-jobs", "3" });
+    auto &config = initConfig(args);
+    QCOMPARE(config.jobs(), expected);
+}
+
+void tst_Config::cacheDir()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString cacheDir = tempDir.filePath("cache/qdoc");
+    QVERIFY(!QFileInfo::exists(cacheDir));
+
+    // The directory is created, and a relative path is made absolute.
+    const QString current = QDir::currentPath();
+    QVERIFY(QDir::setCurrent(tempDir.path()));
+    auto &config = initConfig({ "-cache-dir", "cache/qdoc" });
+    QVERIFY(QDir::setCurrent(current));
+    QVERIFY(QDir::isAbsolutePath(config.cacheDir()));
+    QVERIFY(QFileInfo(cacheDir).isDir());
+    QCOMPARE(QFileInfo(config.cacheDir()).canonicalFilePath(),
+             QFileInfo(cacheDir).canonicalFilePath());
+
+    QVERIFY(initConfig().cacheDir().isEmpty());
+}
+
 QTEST_APPLESS_MAIN(tst_Config)
 
 #include "tst_config.moc"
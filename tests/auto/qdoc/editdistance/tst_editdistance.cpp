@@ -0,0 +1,120 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "editdistance.h"
+
+#include <QtTest/QtTest>
+
+class tst_EditDistance : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void editDistance_data();
+    void editDistance();
+    void boundedEditDistance_data();
+    void boundedEditDistance();
+    void nearestName_data();
+    void nearestName();
+};
+
+void tst_EditDistance::editDistance_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<QString>("t");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("empty") << QString() << QString() << 0;
+    QTest::newRow("insertions only") << QString() << "abc" << 3;
+    QTest::newRow("deletions only") << "abc" << QString() << 3;
+    QTest::newRow("equal") << "QString" << "QString" << 0;
+    QTest::newRow("substitution") << "QString" << "QStrong" << 1;
+    QTest::newRow("transposition") << "QStirng" << "QString" << 2;
+    QTest::newRow("kitten") << "kitten" << "sitting" << 3;
+    QTest::newRow("unrelated") << "abc" << "xyz" << 3;
+    QTest::newRow("different lengths") << "setText" << "setPlainTextFormat" << 11;
+}
+
+void tst_EditDistance::editDistance()
+{
+    QFETCH(QString, s);
+    QFETCH(QString, t);
+    QFETCH(int, expected);
+
+    QCOMPARE(::editDistance(s, t), expected);
+    QCOMPARE(::editDistance(t, s), expected);
+}
+
+void tst_EditDistance::boundedEditDistance_data()
+{
+    QTest::addColumn<QString>("s");
+    QTest::addColumn<QString>("t");
+    QTest::addColumn<int>("bound");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("within") << "kitten" << "sitting" << 3 << 3;
+    QTest::newRow("above") << "kitten" << "sitting" << 2 << 3;
+    QTest::newRow("far above") << "kitten" << "sitting" << 1 << 2;
+    QTest::newRow("zero bound, equal") << "name" << "name" << 0 << 0;
+    QTest::newRow("zero bound, different") << "name" << "same" << 0 << 1;
+    QTest::newRow("length difference above") << "ab" << "abcde" << 2 << 3;
+    QTest::newRow("length difference within") << "ab" << "abcd" << 2 << 2;
+    QTest::newRow("empty within") << QString() << "ab" << 2 << 2;
+    QTest::newRow("empty above") << QString() << "abc" << 2 << 3;
+    QTest::newRow("change at both ends") << "xbcdefgy" << "abcdefgh" << 2 << 2;
+    QTest::newRow("change at both ends, above") << "xbcdefgy" << "abcdefgh" << 1 << 2;
+    QTest::newRow("bound above both lengths") << "a" << "b" << 100 << 1;
+    QTest::newRow("rotation at band edge") << "xabcdefgh" << "abcdefghx" << 2 << 2;
+    QTest::newRow("rotation outside band") << "abcdef" << "bcdefa" << 1 << 2;
+    QTest::newRow("swap within") << "ab" << "ba" << 2 << 2;
+    QTest::newRow("swap above") << "ab" << "ba" << 1 << 2;
+    QTest::newRow("early row above bound") << "abcd" << "dcba" << 2 << 3;
+    QTest::newRow("two swaps above") << "abcdefgh" << "abdcefhg" << 3 << 4;
+    QTest::newRow("prefix within") << "abcde" << "xxcde" << 2 << 2;
+    QTest::newRow("prefix above") << "abcde" << "xxxde" << 2 << 3;
+}
+
+void tst_EditDistance::boundedEditDistance()
+{
+    QFETCH(QString, s);
+    QFETCH(QString, t);
+    QFETCH(int, bound);
+    QFETCH(int, expected);
+
+    QCOMPARE(::boundedEditDistance(s, t, bound), expected);
+    QCOMPARE(::boundedEditDistance(t, s, bound), expected);
+}
+
+void tst_EditDistance::nearestName_data()
+{
+    QTest::addColumn<QString>("actual");
+    QTest::addColumn<QStringList>("candidates");
+    QTest::addColumn<QString>("expected");
+
+    const QStringList names = { "setText", "setTitle", "setFont", "text", "title", "size" };
+    QTest::newRow("one typo") << "setTxt" << names << "setText";
+    QTest::newRow("two typos") << "setTxet" << names << "setText";
+    QTest::newRow("three typos") << "sTxet" << names << QString();
+    QTest::newRow("exact") << "setFont" << names << "setFont";
+    QTest::newRow("ambiguous") << "setTitleX" << QStringList{ "setTitles", "setTitled" }
+                               << QString();
+    QTest::newRow("closer wins") << "setTitl" << QStringList{ "setTitle", "setTitles" }
+                                 << "setTitle";
+    QTest::newRow("other first character") << "zext" << names << QString();
+    QTest::newRow("too short") << "tx" << QStringList{ "t" } << QString();
+    QTest::newRow("empty") << QString() << names << QString();
+}
+
+void tst_EditDistance::nearestName()
+{
+    QFETCH(QString, actual);
+    QFETCH(QStringList, candidates);
+    QFETCH(QString, expected);
+
+    const QSet<QString> candidateSet(candidates.cbegin(), candidates.cend());
+    QCOMPARE(::nearestName(actual, candidateSet), expected);
+}
+
+QTEST_APPLESS_MAIN(tst_EditDistance)
+
+#include "tst_editdistance.moc"
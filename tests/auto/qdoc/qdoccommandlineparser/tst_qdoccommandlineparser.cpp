@@ -14,6 +14,8 @@ private slots:
     void defaultConstructor();
     void process();
     void argumentsFromCommandLineAndFile();
+    void jobsAndCacheDir_data();
+    void jobsAndCacheDir();
 };
 
 void tst_QDocCommandLineParser::defaultConstructor()
@@ -152,10 +154,48 @@ void tst_QDocCommandLineParser::argumentsFromCommandLineAndFile()
     QVERIFY(!parser.isSet(parser.logProgressOption));
     QVERIFY(!parser.isSet(parser.singleExecOption));
     QVERIFY(!parser.isSet(parser.frameworkOption));
+    QVERIFY(!parser.isSet(parser.jobsOption));
+    QVERIFY(!parser.isSet(parser.cacheDirOption));
 
     QCOMPARE(parser.positionalArguments(), expectedPositionalArgument);
 }
 
+void tst_QDocCommandLineParser::jobsAndCacheDir_data()
+{
+    QTest::addColumn<QStringList>("options");
+    QTest::addColumn<QString>("jobs");
+    QTest::addColumn<QString>("cacheDir");
+
+    QTest::newRow("none") << QStringList() << QString() << QString();
+    QTest::newRow("jobs") << QStringList{ "-jobs", "4" } << "4" << QString();
+    QTest::newRow("short jobs") << QStringList{ "-j", "0" } << "0" << QString();
+    QTest::newRow("jobs with equals") << QStringList{ "-jobs=8" } << "8" << QString();
+    QTest::newRow("cache-dir")
+            << QStringList{ "-cache-dir", "/tmp/qdoc-cache" } << QString() << "/tmp/qdoc-cache";
+    QTest::newRow("both")
+            << QStringList{ "-cache-dir", "cache", "-j", "2" } << "2" << "cache";
+}
+
+void tst_QDocCommandLineParser::jobsAndCacheDir()
+{
+    QFETCH(QStringList, options);
+    QFETCH(QString, jobs);
+    QFETCH(QString, cacheDir);
+
+    QStringList arguments { "/src/qt5/qtbase/bin/qdoc" };
+    arguments << options << "/src/qt5/qtgamepad/src/gamepad/doc/qtgamepad.qdocconf";
+
+    QDocCommandLineParser parser;
+    parser.process(arguments);
+
+    QCOMPARE(parser.isSet(parser.jobsOption), !jobs.isNull());
+    QCOMPARE(parser.value(parser.jobsOption), jobs);
+    QCOMPARE(parser.isSet(parser.cacheDirOption), !cacheDir.isNull());
+    QCOMPARE(parser.value(parser.cacheDirOption), cacheDir);
+    QCOMPARE(parser.positionalArguments(),
+             QStringList("/src/qt5/qtgamepad/src/gamepad/doc/qtgamepad.qdocconf"));
+}
+
 QTEST_APPLESS_MAIN(tst_QDocCommandLineParser)
 
 #include "tst_qdoccommandlineparser.moc"
@@ -0,0 +1,103 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtTest/QtTest>
+
+#include <QtGui/QTextDocument>
+
+#include <QtHelp/private/qhelphtmltextextractor_p.h>
+
+class tst_QHelpHtmlTextExtractor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sameAsTextDocument_data();
+    void sameAsTextDocument();
+    void entities_data();
+    void entities();
+};
+
+// The extractor replaces the QTextDocument based text extraction of the
+// search indexer, so both have to agree on the entities QTextDocument knows.
+void tst_QHelpHtmlTextExtractor::sameAsTextDocument_data()
+{
+    QTest::addColumn<QByteArray>("html");
+
+    QTest::newRow("plain")
+            << QByteArray("<html><head><title>Plain Page</title></head>"
+                          "<body><p>Some text.</p></body></html>");
+    QTest::newRow("basic entities")
+            << QByteArray("<html><head><title>Q &amp; A</title></head>"
+                          "<body><p>&lt;tag&gt; &quot;quoted&quot; &apos;single&apos;</p>"
+                          "</body></html>");
+    QTest::newRow("latin-1")
+            << QByteArray("<html><head><title>Caf&eacute; &copy; 2023</title></head>"
+                          "<body><p>&Auml;rger &szlig; &frac12; &plusmn;1 &deg;C &sect;3 "
+                          "&micro;s &yen; &pound; &euro;</p></body></html>");
+    QTest::newRow("symbols")
+            << QByteArray("<html><head><title>&alpha; &rarr; &omega;</title></head>"
+                          "<body><p>&forall;x &isin; &Sigma; &hellip; &mdash; &ndash; "
+                          "&lsquo;a&rsquo; &ldquo;b&rdquo; &bull; &trade; &le; &ne; &infin;"
+                          "</p></body></html>");
+    QTest::newRow("numeric")
+            << QByteArray("<html><head><title>&#65;&#x42;</title></head>"
+                          "<body><p>&#169; &#x2014; &#8364;</p></body></html>");
+    QTest::newRow("non-breaking space")
+            << QByteArray("<html><head><title>A&nbsp;B</title></head>"
+                          "<body><p>C&nbsp;D&#160;E</p></body></html>");
+    QTest::newRow("blocks")
+            << QByteArray("<html><head><title>Blocks</title></head>"
+                          "<body><h1>Heading</h1><ul><li>One</li><li>Two &amp; three</li>"
+                          "</ul><table><tr><td>Cell</td></tr></table></body></html>");
+}
+
+void tst_QHelpHtmlTextExtractor::sameAsTextDocument()
+{
+    QFETCH(QByteArray, html);
+
+    QTextDocument document;
+    document.setHtml(QString::fromUtf8(html));
+    const QHelpHtmlTextExtractor extractor = QHelpHtmlTextExtractor::fromHtml(html);
+
+    QCOMPARE(extractor.title(), document.metaInformation(QTextDocument::DocumentTitle));
+    QCOMPARE(extractor.text().simplified(), document.toPlainText().simplified());
+}
+
+void tst_QHelpHtmlTextExtractor::entities_data()
+{
+    QTest::addColumn<QByteArray>("html");
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("html5 only")
+            << QByteArray("&bigstar; &NewLine;x &Lang;")
+            << QString(QChar(0x2605)) + u' ' + u'x' + u' ' + QChar(0x27ea);
+    QTest::newRow("two code points")
+            << QByteArray("&NotEqualTilde;")
+            << QString(QChar(0x2242)) + QChar(0x0338);
+    QTest::newRow("outside the BMP")
+            << QByteArray("&Afr;")
+            << QString::fromUcs4(U"\U0001d504");
+    QTest::newRow("longest name")
+            << QByteArray("&CounterClockwiseContourIntegral;")
+            << QString(QChar(0x2233));
+    QTest::newRow("case sensitive")
+            << QByteArray("&AMP; &Amp;")
+            << QStringLiteral("& &Amp;");
+    QTest::newRow("unknown")
+            << QByteArray("&nosuchentity; &amp")
+            << QStringLiteral("&nosuchentity; &amp");
+}
+
+void tst_QHelpHtmlTextExtractor::entities()
+{
+    QFETCH(QByteArray, html);
+    QFETCH(QString, text);
+
+    const QByteArray page = "<html><body><p>" + html + "</p></body></html>";
+    QCOMPARE(QHelpHtmlTextExtractor::fromHtml(page).text().simplified(), text);
+}
+
+QTEST_MAIN(tst_QHelpHtmlTextExtractor)
+
+#include "tst_qhelphtmltextextractor.moc"
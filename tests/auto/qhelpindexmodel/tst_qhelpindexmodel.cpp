@@ -51,8 +51,13 @@ private slots:
 
     void setupIndex();
     void filter();
+    void filterSequence_data();
+    void filterSequence();
+    void wildcardFilter();
 
 private:
+    void waitForIndex(QHelpEngine *engine);
+
     QString m_colFile;
 };
 
@@ -128,5 +133,86 @@ void tst_QHelpIndexModel::filter()
     QCOMPARE(m->stringList().count(), 11);
 }
 
+void tst_QHelpIndexModel::waitForIndex(QHelpEngine *engine)
+{
+    SignalWaiter w;
+    connect(engine->indexModel(), SIGNAL(indexCreated()),
+        &w, SLOT(stopWaiting()));
+    w.start();
+    engine->setupData();
+    int i = 0;
+    while (w.isRunning() && i++ < 10)
+        QTest::qWait(500);
+}
+
+void tst_QHelpIndexModel::filterSequence_data()
+{
+    QTest::addColumn<QStringList>("filters");
+
+    QTest::newRow("narrowing")
+            << QStringList{ "f", "fo", "foo", "foob", "fooba", "foobar" };
+    QTest::newRow("narrowing past a space")
+            << QStringList{ "q", "qm", "qmake", "qmake ", "qmake r", "qmake reference" };
+    QTest::newRow("widening")
+            << QStringList{ "foobar", "fooba", "foob", "foo", "fo", "f" };
+    QTest::newRow("unrelated")
+            << QStringList{ "foo", "bar", "xyz", "qmake", "ake", "", "Using" };
+    QTest::newRow("case folding")
+            << QStringList{ "FOO", "Foo", "fOoBaR", "QMAKE", "RUNNING QMAKE", "running Qmake" };
+}
+
+// Each filter in a row has to give the same keywords as a plain search,
+// whatever the filters before it.
+void tst_QHelpIndexModel::filterSequence()
+{
+    QFETCH(QStringList, filters);
+
+    QHelpEngine h(m_colFile, 0);
+    h.setReadOnly(false);
+    waitForIndex(&h);
+    QHelpIndexModel *m = h.indexModel();
+    const QStringList all = m->stringList();
+    QCOMPARE(all.count(), 19);
+
+    for (const QString &filter : std::as_const(filters)) {
+        const QModelIndex current = m->filter(filter);
+        const QStringList expected = all.filter(filter, Qt::CaseInsensitive);
+        QVERIFY2(m->stringList() == expected, qPrintable(filter));
+        // The keyword equal to the filter, ignoring case, is the current one.
+        const auto exact = std::find_if(expected.cbegin(), expected.cend(),
+                                        [&filter](const QString &keyword) {
+            return keyword.compare(filter, Qt::CaseInsensitive) == 0;
+        });
+        if (exact != expected.cend())
+            QCOMPARE(current.data().toString(), *exact);
+    }
+}
+
+void tst_QHelpIndexModel::wildcardFilter()
+{
+    QHelpEngine h(m_colFile, 0);
+    h.setReadOnly(false);
+    waitForIndex(&h);
+    QHelpIndexModel *m = h.indexModel();
+    QCOMPARE(m->stringList().count(), 19);
+
+    m->filter("qmake");
+    m->filter("qmake", "qmake*reference");
+    QCOMPARE(m->stringList(), QStringList({ "qmake Function Reference", "qmake Reference",
+                                            "qmake Variable Reference" }));
+
+    m->filter("b", "b?a");
+    QCOMPARE(m->stringList(), QStringList("bla"));
+
+    // A plain filter after a wildcard one searches all the keywords again.
+    m->filter("qmake re");
+    QCOMPARE(m->stringList(), QStringList("qmake Reference"));
+
+    m->filter("f", "F*O*");
+    QCOMPARE(m->stringList().count(), 5);
+    QVERIFY(m->stringList().contains("Configuring qmake's Environment"));
+    QVERIFY(m->stringList().contains("foobar"));
+}
+
 QTEST_MAIN(tst_QHelpIndexModel)
 #include "tst_qhelpindexmodel.moc"
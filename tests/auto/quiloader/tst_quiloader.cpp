@@ -0,0 +1,203 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtTest/QtTest>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryDir>
+
+#include <QtUiTools/QUiLoader>
+
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QSpinBox>
+#include <QtWidgets/QStackedWidget>
+#include <QtWidgets/QTabWidget>
+
+#include <memory>
+
+class tst_QUiLoader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void deferredPageLoading_data();
+    void deferredPageLoading();
+    void deferredPagesOutliveLoader();
+    void cacheDirectory();
+
+private:
+    QWidget *load(QUiLoader *loader, const QString &fileName, QWidget *parent = nullptr);
+    void checkGeometryPage(const QWidget *form);
+    void checkNestedPage(const QWidget *form);
+};
+
+QWidget *tst_QUiLoader::load(QUiLoader *loader, const QString &fileName, QWidget *parent)
+{
+    QFile file(QLatin1String(SRCDIR "/data/") + fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return nullptr;
+    return loader->load(&file, parent);
+}
+
+// The page without a layout keeps the geometry and the buddy of its children.
+void tst_QUiLoader::checkGeometryPage(const QWidget *form)
+{
+    auto *page = form->findChild<QWidget *>(QStringLiteral("geometryPage"));
+    QVERIFY(page);
+    auto *label = form->findChild<QLabel *>(QStringLiteral("nameLabel"));
+    QVERIFY(label);
+    auto *edit = form->findChild<QLineEdit *>(QStringLiteral("nameEdit"));
+    QVERIFY(edit);
+    QCOMPARE(label->parentWidget(), page);
+    QCOMPARE(edit->parentWidget(), page);
+    QCOMPARE(label->geometry(), QRect(10, 20, 100, 30));
+    QCOMPARE(edit->geometry(), QRect(120, 20, 150, 30));
+    QCOMPARE(label->buddy(), edit);
+}
+
+// The stacked widget on a deferred page defers its own inactive page.
+void tst_QUiLoader::checkNestedPage(const QWidget *form)
+{
+    auto *page = form->findChild<QWidget *>(QStringLiteral("innerSecondPage"));
+    QVERIFY(page);
+    auto *spinBox = form->findChild<QSpinBox *>(QStringLiteral("innerSpinBox"));
+    QVERIFY(spinBox);
+    QCOMPARE(spinBox->parentWidget(), page);
+    QCOMPARE(spinBox->geometry(), QRect(30, 40, 80, 25));
+}
+
+void tst_QUiLoader::deferredPageLoading_data()
+{
+    QTest::addColumn<bool>("withParent");
+
+    QTest::newRow("top-level") << false;
+    QTest::newRow("child") << true;
+}
+
+void tst_QUiLoader::deferredPageLoading()
+{
+    QFETCH(bool, withParent);
+
+    QUiLoader loader;
+    QVERIFY(!loader.isDeferredPageLoadingEnabled());
+    loader.setDeferredPageLoadingEnabled(true);
+    QVERIFY(loader.isDeferredPageLoadingEnabled());
+
+    std::unique_ptr<QWidget> parent(withParent ? new QWidget : nullptr);
+    QWidget *form = load(&loader, QStringLiteral("deferredpages.ui"), parent.get());
+    QVERIFY2(form, qPrintable(loader.errorString()));
+    std::unique_ptr<QWidget> formOwner(withParent ? nullptr : form);
+
+    // Only the current page is created.
+    QVERIFY(form->findChild<QWidget *>(QStringLiteral("firstButton")));
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("nameLabel")));
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("stackedWidget")));
+
+    QWidget *window = withParent ? parent.get() : form;
+    window->show();
+    auto *tabWidget = form->findChild<QTabWidget *>(QStringLiteral("tabWidget"));
+    QVERIFY(tabWidget);
+
+    tabWidget->setCurrentIndex(1);
+    checkGeometryPage(form);
+    if (QTest::currentTestFailed())
+        return;
+    QVERIFY(form->findChild<QLabel *>(QStringLiteral("nameLabel"))->isVisible());
+
+    tabWidget->setCurrentIndex(2);
+    auto *stackedWidget = form->findChild<QStackedWidget *>(QStringLiteral("stackedWidget"));
+    QVERIFY(stackedWidget);
+    QVERIFY(form->findChild<QWidget *>(QStringLiteral("innerCheckBox")));
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("innerSpinBox")));
+
+    stackedWidget->setCurrentIndex(1);
+    checkNestedPage(form);
+}
+
+// Pages stay deferred when the loader is destroyed, and are created when
+// they are shown, with the same result as with the loader.
+void tst_QUiLoader::deferredPagesOutliveLoader()
+{
+    std::unique_ptr<QWidget> form;
+    {
+        QUiLoader loader;
+        loader.setDeferredPageLoadingEnabled(true);
+        form.reset(load(&loader, QStringLiteral("deferredpages.ui")));
+        QVERIFY2(form, qPrintable(loader.errorString()));
+    }
+
+    QCOMPARE(form->size(), QSize(400, 300));
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("nameLabel")));
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("stackedWidget")));
+
+    form->show();
+    auto *tabWidget = form->findChild<QTabWidget *>(QStringLiteral("tabWidget"));
+    QVERIFY(tabWidget);
+    tabWidget->setCurrentIndex(1);
+    checkGeometryPage(form.get());
+    if (QTest::currentTestFailed())
+        return;
+
+    tabWidget->setCurrentIndex(2);
+    auto *stackedWidget = form->findChild<QStackedWidget *>(QStringLiteral("stackedWidget"));
+    QVERIFY(stackedWidget);
+    QVERIFY(!form->findChild<QWidget *>(QStringLiteral("innerSpinBox")));
+    stackedWidget->setCurrentIndex(1);
+    checkNestedPage(form.get());
+}
+
+void tst_QUiLoader::cacheDirectory()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString formFileName = tempDir.filePath(QStringLiteral("form.ui"));
+    const QString cacheDirectory = tempDir.filePath(QStringLiteral("cache"));
+    QVERIFY(QFile::copy(QLatin1String(SRCDIR "/data/deferredpages.ui"), formFileName));
+    QVERIFY(QFile::setPermissions(formFileName, QFile::ReadOwner | QFile::WriteOwner));
+
+    QUiLoader loader;
+    QVERIFY(loader.cacheDirectory().isEmpty());
+    loader.setCacheDirectory(cacheDirectory);
+    QCOMPARE(loader.cacheDirectory(), cacheDirectory);
+
+    const auto labelText = [&]() {
+        QFile file(formFileName);
+        if (!file.open(QIODevice::ReadOnly))
+            return QString();
+        std::unique_ptr<QWidget> form(loader.load(&file));
+        const auto *label = form ? form->findChild<QLabel *>(QStringLiteral("nameLabel")) : nullptr;
+        return label ? label->text() : QString();
+    };
+
+    // The first load writes the binary copy, the second one reads it.
+    QCOMPARE(labelText(), QStringLiteral("&Name:"));
+    QCOMPARE(QDir(cacheDirectory).entryList(QDir::Files).size(), 1);
+    QCOMPARE(labelText(), QStringLiteral("&Name:"));
+
+    // An edit that keeps the size and the modification time of the file
+    // still replaces the copy.
+    QFile file(formFileName);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    const QDateTime lastModified = file.fileTime(QFileDevice::FileModificationTime);
+    QByteArray contents = file.readAll();
+    QVERIFY(contents.contains("&amp;Name:"));
+    contents.replace("&amp;Name:", "&amp;Nick:");
+    QVERIFY(file.seek(0));
+    QCOMPARE(file.write(contents), contents.size());
+    file.flush();
+    QVERIFY(file.setFileTime(lastModified, QFileDevice::FileModificationTime));
+    file.close();
+    QCOMPARE(QFileInfo(formFileName).lastModified(), lastModified);
+
+    QCOMPARE(labelText(), QStringLiteral("&Nick:"));
+    QCOMPARE(QDir(cacheDirectory).entryList(QDir::Files).size(), 1);
+    QCOMPARE(labelText(), QStringLiteral("&Nick:"));
+}
+
+QTEST_MAIN(tst_QUiLoader)
+
+#include "tst_quiloader.moc"
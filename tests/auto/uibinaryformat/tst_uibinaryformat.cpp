@@ -0,0 +1,178 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtTest/QtTest>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QDirIterator>
+#include <QtCore/QFile>
+#include <QtCore/QXmlStreamReader>
+#include <QtCore/QXmlStreamWriter>
+
+#include <QtDesigner/private/ui4_p.h>
+#include <QtDesigner/private/uibinaryformat_p.h>
+
+#include <memory>
+
+class tst_UiBinaryFormat : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip_data();
+    void roundTrip();
+    void rejectsOtherData();
+    void nestingDepth_data();
+    void nestingDepth();
+};
+
+static DomUI *readXml(const QByteArray &contents)
+{
+    QXmlStreamReader reader(contents);
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QXmlStreamReader::StartElement) {
+            if (reader.name().compare(QLatin1String("ui"), Qt::CaseInsensitive) != 0)
+                return nullptr;
+            auto *ui = new DomUI;
+            ui->read(reader);
+            if (reader.hasError()) {
+                delete ui;
+                return nullptr;
+            }
+            return ui;
+        }
+    }
+    return nullptr;
+}
+
+static QByteArray writeXml(const DomUI *ui)
+{
+    QByteArray result;
+    QXmlStreamWriter writer(&result);
+    writer.setAutoFormatting(true);
+    writer.writeStartDocument();
+    ui->write(writer);
+    writer.writeEndDocument();
+    return result;
+}
+
+// All the forms of the source tree, which use most of the schema.
+void tst_UiBinaryFormat::roundTrip_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    const QString sourceDirectory = QFileInfo(QLatin1String(SRCDIR "/../../../src"))
+                                            .canonicalFilePath();
+    QDirIterator it(sourceDirectory, { QStringLiteral("*.ui") }, QDir::Files,
+                    QDirIterator::Subdirectories);
+    QStringList fileNames;
+    while (it.hasNext())
+        fileNames.append(it.next());
+    fileNames.sort();
+    for (const QString &fileName : std::as_const(fileNames)) {
+        const QString name = fileName.mid(sourceDirectory.size() + 1);
+        QTest::newRow(qPrintable(name)) << fileName;
+    }
+}
+
+void tst_UiBinaryFormat::roundTrip()
+{
+    QFETCH(QString, fileName);
+
+    QFile file(fileName);
+    QVERIFY2(file.open(QIODevice::ReadOnly), qPrintable(file.errorString()));
+    const std::unique_ptr<DomUI> ui(readXml(file.readAll()));
+    QVERIFY(ui);
+
+    QBuffer binary;
+    binary.open(QIODevice::WriteOnly);
+    QVERIFY(QUiBinaryFormat::write(ui.get(), &binary));
+    binary.close();
+
+    binary.open(QIODevice::ReadOnly);
+    QVERIFY(QUiBinaryFormat::canRead(&binary));
+    QString errorMessage;
+    const std::unique_ptr<DomUI> copy(QUiBinaryFormat::read(&binary, &errorMessage));
+    QVERIFY2(copy, qPrintable(errorMessage));
+    QVERIFY(binary.atEnd());
+
+    QCOMPARE(writeXml(copy.get()), writeXml(ui.get()));
+}
+
+void tst_UiBinaryFormat::rejectsOtherData()
+{
+    QBuffer xml;
+    xml.setData("<ui version=\"4.0\"/>");
+    xml.open(QIODevice::ReadOnly);
+    QVERIFY(!QUiBinaryFormat::canRead(&xml));
+
+    // A truncated form is reported as an error.
+    const std::unique_ptr<DomUI> ui(readXml("<ui version=\"4.0\"><class>Form</class>"
+                                            "<widget class=\"QWidget\" name=\"Form\"/></ui>"));
+    QVERIFY(ui);
+    QBuffer binary;
+    binary.open(QIODevice::WriteOnly);
+    QVERIFY(QUiBinaryFormat::write(ui.get(), &binary));
+    binary.close();
+    QByteArray data = binary.data();
+    data.chop(4);
+    binary.setData(data);
+    binary.open(QIODevice::ReadOnly);
+    QString errorMessage;
+    QVERIFY(!QUiBinaryFormat::read(&binary, &errorMessage));
+    QVERIFY(!errorMessage.isEmpty());
+}
+
+// A form of widgets nested \a depth levels deep below the DomUI.
+static DomUI *nestedWidgets(int depth)
+{
+    auto *ui = new DomUI;
+    DomWidget *parent = nullptr;
+    for (int i = 0; i < depth; ++i) {
+        auto *widget = new DomWidget;
+        widget->setAttributeClass(QStringLiteral("QWidget"));
+        if (parent)
+            parent->setElementWidget({widget});
+        else
+            ui->setElementWidget(widget);
+        parent = widget;
+    }
+    return ui;
+}
+
+void tst_UiBinaryFormat::nestingDepth_data()
+{
+    QTest::addColumn<int>("depth");
+    QTest::addColumn<bool>("valid");
+
+    // The DomUI counts as one level.
+    QTest::newRow("shallow") << 10 << true;
+    QTest::newRow("at the limit") << QUiBinaryReader::maxDepth - 1 << true;
+    QTest::newRow("above the limit") << QUiBinaryReader::maxDepth << false;
+}
+
+// The nesting read from a file is bounded, so a corrupt file cannot
+// exhaust the stack.
+void tst_UiBinaryFormat::nestingDepth()
+{
+    QFETCH(int, depth);
+    QFETCH(bool, valid);
+
+    const std::unique_ptr<DomUI> ui(nestedWidgets(depth));
+    QBuffer binary;
+    binary.open(QIODevice::WriteOnly);
+    QVERIFY(QUiBinaryFormat::write(ui.get(), &binary));
+    binary.close();
+
+    binary.open(QIODevice::ReadOnly);
+    QString errorMessage;
+    const std::unique_ptr<DomUI> copy(QUiBinaryFormat::read(&binary, &errorMessage));
+    QCOMPARE(bool(copy), valid);
+    QCOMPARE(errorMessage.isEmpty(), valid);
+    if (valid)
+        QCOMPARE(writeXml(copy.get()), writeXml(ui.get()));
+}
+
+QTEST_MAIN(tst_UiBinaryFormat)
+
+#include "tst_uibinaryformat.moc"
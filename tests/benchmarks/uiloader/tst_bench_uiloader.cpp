@@ -0,0 +1,55 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <QtTest/QtTest>
+
+#include <QtCore/QBuffer>
+#include <QtCore/QFile>
+
+#include <QtUiTools/QUiLoader>
+
+#include <QtWidgets/QWidget>
+
+#include <memory>
+
+class tst_UiLoader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void load_data();
+    void load();
+};
+
+void tst_UiLoader::load_data()
+{
+    QTest::addColumn<QString>("fileName");
+
+    // A main window with menus and actions, a form with custom widgets and
+    // many properties, and a dialog built from nested layouts.
+    QTest::newRow("mainwindow") << QStringLiteral("mainwindow.ui");
+    QTest::newRow("gradienteditor") << QStringLiteral("gradienteditor.ui");
+    QTest::newRow("imagedialog") << QStringLiteral("imagedialog.ui");
+}
+
+void tst_UiLoader::load()
+{
+    QFETCH(QString, fileName);
+
+    QFile file(QLatin1String(SRCDIR "/data/") + fileName);
+    QVERIFY2(file.open(QIODevice::ReadOnly), qPrintable(file.errorString()));
+    const QByteArray contents = file.readAll();
+
+    QUiLoader loader;
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.setData(contents);
+        buffer.open(QIODevice::ReadOnly);
+        std::unique_ptr<QWidget> form(loader.load(&buffer));
+        QVERIFY2(form, qPrintable(loader.errorString()));
+    }
+}
+
+QTEST_MAIN(tst_UiLoader)
+
+#include "tst_bench_uiloader.moc"